@@ -0,0 +1,56 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include "bench_alloc.h"
+
+#ifdef CCB_BENCH_COUNT_ALLOCATIONS
+
+/* Linked with `-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc`, so every allocation made by
+the benchmark, ccabral and its dependencies goes through these */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t numOfElements, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+/* Updated atomically, since the threads benchmark allocates from several threads */
+static size_t sNumOfAllocations = 0;
+
+void *__wrap_malloc(size_t size)
+{
+    __atomic_fetch_add(&sNumOfAllocations, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t numOfElements, size_t size)
+{
+    __atomic_fetch_add(&sNumOfAllocations, 1, __ATOMIC_RELAXED);
+    return __real_calloc(numOfElements, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size)
+{
+    __atomic_fetch_add(&sNumOfAllocations, 1, __ATOMIC_RELAXED);
+    return __real_realloc(pointer, size);
+}
+
+size_t BenchAlloc__getCount()
+{
+    return __atomic_load_n(&sNumOfAllocations, __ATOMIC_RELAXED);
+}
+
+bool BenchAlloc__isCounting()
+{
+    return true;
+}
+
+#else
+
+size_t BenchAlloc__getCount()
+{
+    return 0;
+}
+
+bool BenchAlloc__isCounting()
+{
+    return false;
+}
+
+#endif
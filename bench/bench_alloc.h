@@ -0,0 +1,13 @@
+#ifndef CCABRAL_BENCH_ALLOC_H
+#define CCABRAL_BENCH_ALLOC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Number of `malloc`, `calloc` and `realloc` calls made since the program started. Only
+counted when the linker wraps the allocation functions, see `BenchAlloc__isCounting` */
+size_t BenchAlloc__getCount();
+
+bool BenchAlloc__isCounting();
+
+#endif
@@ -0,0 +1,411 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <cbarroso/hashmap.h>
+#include <ccabral/constants.h>
+#include <ccabral/prdcdata.h>
+#include "bench_grammars.h"
+
+#define EMPTY CCB_EMPTY_STRING_TR
+
+uint32_t BenchRandom__next(BenchRandom *self)
+{
+    self->state ^= self->state << 13;
+    self->state ^= self->state >> 7;
+    self->state ^= self->state << 17;
+
+    return (uint32_t)(self->state >> 32);
+}
+
+/* Prefix expressions: `E --> num | '+' E E | '*' E E | '(' E rp`, `rp --> ')'` */
+
+#define EXPR_E_NT (CCB_nonterminal_t)0
+#define EXPR_RP_NT (CCB_nonterminal_t)1
+
+#define EXPR_NUM_TR (CCB_terminal_t)2
+#define EXPR_PLUS_TR (CCB_terminal_t)3
+#define EXPR_TIMES_TR (CCB_terminal_t)4
+#define EXPR_LPAREN_TR (CCB_terminal_t)5
+#define EXPR_RPAREN_TR (CCB_terminal_t)6
+
+#define EXPR_MAX_PENDING 64
+
+static const BenchRule kExpressionRules[] = {
+    {EXPR_E_NT, EXPR_NUM_TR, 0, {0}},
+    {EXPR_E_NT, EXPR_PLUS_TR, 2, {EXPR_E_NT, EXPR_E_NT}},
+    {EXPR_E_NT, EXPR_TIMES_TR, 2, {EXPR_E_NT, EXPR_E_NT}},
+    {EXPR_E_NT, EXPR_LPAREN_TR, 2, {EXPR_E_NT, EXPR_RP_NT}},
+    {EXPR_RP_NT, EXPR_RPAREN_TR, 0, {0}},
+};
+
+static size_t sGenerateExpression(
+    CCB_terminal_t *tokens,
+    size_t maxNumOfTokens,
+    BenchRandom *random)
+{
+    /* What is still to be written, each one taking at least one token: `EXPR_E_NT` for an
+    operand or `EXPR_RP_NT` for a closing parenthesis */
+    CCB_nonterminal_t pending[EXPR_MAX_PENDING + 2] = {EXPR_E_NT};
+    size_t numOfPending = 1;
+    size_t position = 0;
+
+    while (numOfPending > 0)
+    {
+        CCB_nonterminal_t next = pending[--numOfPending];
+
+        if (next == EXPR_RP_NT)
+        {
+            tokens[position++] = EXPR_RPAREN_TR;
+            continue;
+        }
+
+        bool hasRoom = position + numOfPending + 3 <= maxNumOfTokens &&
+                       numOfPending < EXPR_MAX_PENDING;
+        uint32_t choice = BenchRandom__next(random) % 10;
+
+        /* The last operand keeps the expression growing until the stream is full */
+        if (hasRoom && (numOfPending == 0 || choice < 4))
+        {
+            tokens[position++] = choice % 2 ? EXPR_PLUS_TR : EXPR_TIMES_TR;
+            pending[numOfPending++] = EXPR_E_NT;
+            pending[numOfPending++] = EXPR_E_NT;
+        }
+        else if (hasRoom && choice == 4)
+        {
+            tokens[position++] = EXPR_LPAREN_TR;
+            pending[numOfPending++] = EXPR_RP_NT;
+            pending[numOfPending++] = EXPR_E_NT;
+        }
+        else
+        {
+            tokens[position++] = EXPR_NUM_TR;
+        }
+    }
+
+    return position;
+}
+
+/* JSON-like values: objects, arrays, strings, numbers and literals */
+
+#define JSON_VALUE_NT (CCB_nonterminal_t)0
+#define JSON_MEMBERS_NT (CCB_nonterminal_t)1
+#define JSON_MEMBERS_TAIL_NT (CCB_nonterminal_t)2
+#define JSON_PAIR_NT (CCB_nonterminal_t)3
+#define JSON_COLON_NT (CCB_nonterminal_t)4
+#define JSON_ELEMENTS_NT (CCB_nonterminal_t)5
+#define JSON_ELEMENTS_TAIL_NT (CCB_nonterminal_t)6
+
+#define JSON_LBRACE_TR (CCB_terminal_t)2
+#define JSON_RBRACE_TR (CCB_terminal_t)3
+#define JSON_LBRACKET_TR (CCB_terminal_t)4
+#define JSON_RBRACKET_TR (CCB_terminal_t)5
+#define JSON_COLON_TR (CCB_terminal_t)6
+#define JSON_COMMA_TR (CCB_terminal_t)7
+#define JSON_STRING_TR (CCB_terminal_t)8
+#define JSON_NUMBER_TR (CCB_terminal_t)9
+#define JSON_LITERAL_TR (CCB_terminal_t)10
+
+#define JSON_MAX_DEPTH 16
+#define JSON_MAX_CONTAINER_SIZE 8
+
+static const BenchRule kJsonRules[] = {
+    {JSON_VALUE_NT, JSON_LBRACE_TR, 1, {JSON_MEMBERS_NT}},
+    {JSON_VALUE_NT, JSON_LBRACKET_TR, 1, {JSON_ELEMENTS_NT}},
+    {JSON_VALUE_NT, JSON_STRING_TR, 0, {0}},
+    {JSON_VALUE_NT, JSON_NUMBER_TR, 0, {0}},
+    {JSON_VALUE_NT, JSON_LITERAL_TR, 0, {0}},
+    {JSON_MEMBERS_NT, JSON_RBRACE_TR, 0, {0}},
+    {JSON_MEMBERS_NT, JSON_STRING_TR, 3, {JSON_COLON_NT, JSON_VALUE_NT, JSON_MEMBERS_TAIL_NT}},
+    {JSON_MEMBERS_TAIL_NT, JSON_COMMA_TR, 2, {JSON_PAIR_NT, JSON_MEMBERS_TAIL_NT}},
+    {JSON_MEMBERS_TAIL_NT, JSON_RBRACE_TR, 0, {0}},
+    {JSON_PAIR_NT, JSON_STRING_TR, 2, {JSON_COLON_NT, JSON_VALUE_NT}},
+    {JSON_COLON_NT, JSON_COLON_TR, 0, {0}},
+    {JSON_ELEMENTS_NT, JSON_RBRACKET_TR, 0, {0}},
+    {JSON_ELEMENTS_NT, JSON_LBRACE_TR, 2, {JSON_MEMBERS_NT, JSON_ELEMENTS_TAIL_NT}},
+    {JSON_ELEMENTS_NT, JSON_LBRACKET_TR, 2, {JSON_ELEMENTS_NT, JSON_ELEMENTS_TAIL_NT}},
+    {JSON_ELEMENTS_NT, JSON_STRING_TR, 1, {JSON_ELEMENTS_TAIL_NT}},
+    {JSON_ELEMENTS_NT, JSON_NUMBER_TR, 1, {JSON_ELEMENTS_TAIL_NT}},
+    {JSON_ELEMENTS_NT, JSON_LITERAL_TR, 1, {JSON_ELEMENTS_TAIL_NT}},
+    {JSON_ELEMENTS_TAIL_NT, JSON_COMMA_TR, 2, {JSON_VALUE_NT, JSON_ELEMENTS_TAIL_NT}},
+    {JSON_ELEMENTS_TAIL_NT, JSON_RBRACKET_TR, 0, {0}},
+};
+
+typedef struct JsonGenerator
+{
+    CCB_terminal_t *tokens;
+    size_t position;
+    size_t maxNumOfTokens;
+    BenchRandom *random;
+} JsonGenerator;
+
+static void sJsonGenerator__value(JsonGenerator *self, size_t depth, size_t numOfReserved);
+
+/* Writes the items of a container, each one taking at least `itemSize` tokens, and keeps
+`numOfReserved` tokens free for the containers that are still open */
+static void sJsonGenerator__container(
+    JsonGenerator *self,
+    size_t depth,
+    size_t numOfReserved,
+    bool isObject,
+    size_t maxNumOfItems)
+{
+    size_t itemSize = isObject ? 4 : 2;
+
+    self->tokens[self->position++] = isObject ? JSON_LBRACE_TR : JSON_LBRACKET_TR;
+
+    for (size_t itemIndex = 0;
+         itemIndex < maxNumOfItems &&
+         self->position + itemSize + numOfReserved + 1 <= self->maxNumOfTokens;
+         itemIndex++)
+    {
+        if (itemIndex > 0)
+        {
+            self->tokens[self->position++] = JSON_COMMA_TR;
+        }
+
+        if (isObject)
+        {
+            self->tokens[self->position++] = JSON_STRING_TR;
+            self->tokens[self->position++] = JSON_COLON_TR;
+        }
+
+        sJsonGenerator__value(self, depth + 1, numOfReserved + 1);
+    }
+
+    self->tokens[self->position++] = isObject ? JSON_RBRACE_TR : JSON_RBRACKET_TR;
+}
+
+static void sJsonGenerator__value(JsonGenerator *self, size_t depth, size_t numOfReserved)
+{
+    uint32_t choice = BenchRandom__next(self->random) % 8;
+
+    if (depth < JSON_MAX_DEPTH &&
+        choice < 2 &&
+        self->position + numOfReserved + 2 <= self->maxNumOfTokens)
+    {
+        sJsonGenerator__container(
+            self,
+            depth,
+            numOfReserved,
+            choice == 0,
+            BenchRandom__next(self->random) % JSON_MAX_CONTAINER_SIZE);
+        return;
+    }
+
+    static const CCB_terminal_t kScalars[] = {JSON_STRING_TR, JSON_NUMBER_TR, JSON_LITERAL_TR};
+
+    self->tokens[self->position++] = kScalars[choice % 3];
+}
+
+static size_t sGenerateJson(
+    CCB_terminal_t *tokens,
+    size_t maxNumOfTokens,
+    BenchRandom *random)
+{
+    JsonGenerator generator = {tokens, 0, maxNumOfTokens, random};
+
+    if (maxNumOfTokens < 2)
+    {
+        tokens[0] = JSON_NUMBER_TR;
+        return 1;
+    }
+
+    /* A top-level array that keeps going until the stream is full */
+    sJsonGenerator__container(&generator, 0, 0, false, SIZE_MAX);
+
+    return generator.position;
+}
+
+/* Balanced parentheses nested as deep as possible: `L --> '(' L rp L | e`, `rp --> ')'` */
+
+#define NESTED_L_NT (CCB_nonterminal_t)0
+#define NESTED_RP_NT (CCB_nonterminal_t)1
+
+#define NESTED_LPAREN_TR (CCB_terminal_t)2
+#define NESTED_RPAREN_TR (CCB_terminal_t)3
+
+#define NESTED_MAX_DEPTH 100000
+
+static const BenchRule kNestedRules[] = {
+    {NESTED_L_NT, NESTED_LPAREN_TR, 3, {NESTED_L_NT, NESTED_RP_NT, NESTED_L_NT}},
+    {NESTED_L_NT, EMPTY, 0, {0}},
+    {NESTED_RP_NT, NESTED_RPAREN_TR, 0, {0}},
+};
+
+static size_t sGenerateNested(
+    CCB_terminal_t *tokens,
+    size_t maxNumOfTokens,
+    BenchRandom *random)
+{
+    (void)random;
+
+    size_t position = 0;
+
+    while (position + 2 <= maxNumOfTokens)
+    {
+        size_t depth = (maxNumOfTokens - position) / 2;
+
+        if (depth > NESTED_MAX_DEPTH)
+        {
+            depth = NESTED_MAX_DEPTH;
+        }
+
+        for (size_t i = 0; i < depth; i++)
+        {
+            tokens[position++] = NESTED_LPAREN_TR;
+        }
+
+        for (size_t i = 0; i < depth; i++)
+        {
+            tokens[position++] = NESTED_RPAREN_TR;
+        }
+    }
+
+    return position;
+}
+
+/* Lists whose items share their first tokens, so predicting them needs `k` tokens:
+`L --> 'a' b L | 'a' c L | e` for LL(2) and `L --> 'a' x c L | 'a' y d L | 'z'`, `x --> 'b' c`,
+`y --> 'b' d` for LL(3) */
+
+#define LLK_LIST_NT (CCB_nonterminal_t)0
+#define LLK_B_NT (CCB_nonterminal_t)1
+#define LLK_C_NT (CCB_nonterminal_t)2
+#define LLK_D_NT (CCB_nonterminal_t)3
+#define LLK_X_NT (CCB_nonterminal_t)1
+#define LLK_Y_NT (CCB_nonterminal_t)4
+
+#define LLK_A_TR (CCB_terminal_t)2
+#define LLK_B_TR (CCB_terminal_t)3
+#define LLK_C_TR (CCB_terminal_t)4
+#define LLK_D_TR (CCB_terminal_t)5
+#define LLK_Z_TR (CCB_terminal_t)6
+
+static const BenchRule kLL2Rules[] = {
+    {LLK_LIST_NT, LLK_A_TR, 2, {LLK_B_NT, LLK_LIST_NT}},
+    {LLK_LIST_NT, LLK_A_TR, 2, {LLK_C_NT, LLK_LIST_NT}},
+    {LLK_LIST_NT, EMPTY, 0, {0}},
+    {LLK_B_NT, LLK_B_TR, 0, {0}},
+    {LLK_C_NT, LLK_C_TR, 0, {0}},
+};
+
+static const BenchRule kLL3Rules[] = {
+    {LLK_LIST_NT, LLK_A_TR, 3, {LLK_X_NT, LLK_C_NT, LLK_LIST_NT}},
+    {LLK_LIST_NT, LLK_A_TR, 3, {LLK_Y_NT, LLK_D_NT, LLK_LIST_NT}},
+    {LLK_LIST_NT, LLK_Z_TR, 0, {0}},
+    {LLK_X_NT, LLK_B_TR, 1, {LLK_C_NT}},
+    {LLK_Y_NT, LLK_B_TR, 1, {LLK_D_NT}},
+    {LLK_C_NT, LLK_C_TR, 0, {0}},
+    {LLK_D_NT, LLK_D_TR, 0, {0}},
+};
+
+static size_t sGenerateLL2(
+    CCB_terminal_t *tokens,
+    size_t maxNumOfTokens,
+    BenchRandom *random)
+{
+    size_t position = 0;
+
+    while (position + 2 <= maxNumOfTokens)
+    {
+        tokens[position++] = LLK_A_TR;
+        tokens[position++] = BenchRandom__next(random) % 2 ? LLK_B_TR : LLK_C_TR;
+    }
+
+    return position;
+}
+
+static size_t sGenerateLL3(
+    CCB_terminal_t *tokens,
+    size_t maxNumOfTokens,
+    BenchRandom *random)
+{
+    size_t position = 0;
+
+    while (position + 5 <= maxNumOfTokens)
+    {
+        CCB_terminal_t last = BenchRandom__next(random) % 2 ? LLK_C_TR : LLK_D_TR;
+
+        tokens[position++] = LLK_A_TR;
+        tokens[position++] = LLK_B_TR;
+        tokens[position++] = last;
+        tokens[position++] = last;
+    }
+
+    tokens[position++] = LLK_Z_TR;
+
+    return position;
+}
+
+#define RULES(rules) rules, sizeof(rules) / sizeof(rules[0])
+
+const BenchGrammar kBenchGrammars[] = {
+    {"expression", 1, RULES(kExpressionRules), sGenerateExpression},
+    {"json", 1, RULES(kJsonRules), sGenerateJson},
+    {"nested", 1, RULES(kNestedRules), sGenerateNested},
+    {"ll2", 2, RULES(kLL2Rules), sGenerateLL2},
+    {"ll3", 3, RULES(kLL3Rules), sGenerateLL3},
+};
+
+const size_t kNumOfBenchGrammars = sizeof(kBenchGrammars) / sizeof(kBenchGrammars[0]);
+
+ProductionsHashMap *BenchGrammar__buildProductions(const BenchGrammar *self)
+{
+    ProductionsHashMap *productions = HashMap__new(8);
+
+    if (productions == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for productions data\n");
+        return NULL;
+    }
+
+    bool isInitialized[CCB_NUM_OF_NONTERMINALS] = {false};
+
+    for (size_t ruleIndex = 0; ruleIndex < self->numOfRules; ruleIndex++)
+    {
+        const BenchRule *rule = &self->rules[ruleIndex];
+        ProductionData *production = ProductionData__new(
+            (CCB_production_t)ruleIndex,
+            rule->leftHand,
+            rule->terminal);
+
+        if (production == NULL)
+        {
+            fprintf(stderr, "Failed to create production P%zu\n", ruleIndex);
+            ProductionsHashMap__del(productions);
+            return NULL;
+        }
+
+        for (uint8_t i = 0; i < rule->rightHandLength; i++)
+        {
+            if (ProductionData__insertRightHandGrammar(
+                    production,
+                    rule->rightHand[i]) <= CCB_ERROR)
+            {
+                ProductionData__del(production);
+                ProductionsHashMap__del(productions);
+                return NULL;
+            }
+        }
+
+        int8_t result = isInitialized[rule->leftHand]
+                            ? ProductionsHashMap__insertProdForTerminal(
+                                  productions,
+                                  rule->leftHand,
+                                  production)
+                            : ProductionsHashMap__initializeTerminal(
+                                  productions,
+                                  rule->leftHand,
+                                  production);
+
+        if (result <= CCB_ERROR)
+        {
+            ProductionData__del(production);
+            ProductionsHashMap__del(productions);
+            return NULL;
+        }
+
+        isInitialized[rule->leftHand] = true;
+    }
+
+    return productions;
+}
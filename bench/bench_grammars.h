@@ -0,0 +1,50 @@
+#ifndef CCABRAL_BENCH_GRAMMARS_H
+#define CCABRAL_BENCH_GRAMMARS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ccabral/prdsmap.h>
+#include <ccabral/types.h>
+
+#define BENCH_MAX_RIGHT_HAND_LENGTH 4
+
+/* `leftHand --> terminal rightHand...`, with `CCB_EMPTY_STRING_TR` as `terminal` for the empty
+string */
+typedef struct BenchRule
+{
+    CCB_nonterminal_t leftHand;
+    CCB_terminal_t terminal;
+    uint8_t rightHandLength;
+    CCB_nonterminal_t rightHand[BENCH_MAX_RIGHT_HAND_LENGTH];
+} BenchRule;
+
+/* Deterministic xorshift generator, so every run parses the same streams */
+typedef struct BenchRandom
+{
+    uint64_t state;
+} BenchRandom;
+
+uint32_t BenchRandom__next(BenchRandom *self);
+
+/* Writes a sentence of the grammar with at most `maxNumOfTokens` tokens into `tokens` and
+returns its actual number of tokens */
+typedef size_t (*BenchGenerateCallback)(
+    CCB_terminal_t *tokens,
+    size_t maxNumOfTokens,
+    BenchRandom *random);
+
+typedef struct BenchGrammar
+{
+    const char *name;
+    uint8_t k;
+    const BenchRule *rules;
+    size_t numOfRules;
+    BenchGenerateCallback generate;
+} BenchGrammar;
+
+extern const BenchGrammar kBenchGrammars[];
+extern const size_t kNumOfBenchGrammars;
+
+ProductionsHashMap *BenchGrammar__buildProductions(const BenchGrammar *self);
+
+#endif
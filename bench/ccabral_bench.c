@@ -0,0 +1,983 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <cbarroso/hashmap.h>
+#include <cbarroso/tree.h>
+#include <ccabral/constants.h>
+#include <ccabral/parser.h>
+#include <ccabral/tknsq.h>
+#include <ccabral/types.h>
+#include "bench_alloc.h"
+#include "bench_grammars.h"
+
+#define DEFAULT_MIN_NUM_OF_TOKENS (size_t)100000
+#define DEFAULT_MAX_NUM_OF_TOKENS (size_t)10000000
+#define DEFAULT_NUM_OF_REPEATS 3
+#define DEFAULT_SEED 0x9E3779B97F4A7C15ULL
+
+typedef struct BenchOptions
+{
+    const char *grammarName;
+    size_t minNumOfTokens;
+    size_t maxNumOfTokens;
+    unsigned numOfRepeats;
+    uint64_t seed;
+
+    /* Highest number of threads sharing a parser, or 0 to skip the threads benchmark */
+    unsigned maxNumOfThreads;
+} BenchOptions;
+
+/* Number of productions expanded by the current parse */
+static size_t sNumOfExpansions = 0;
+
+/* Only builds a root node, so the numbers measure the parser rather than the tree */
+static int8_t sBuildRootNode(TreeNode **tree, CCB_production_t rule)
+{
+    (void)rule;
+
+    if (*tree != NULL)
+    {
+        return CCB_SUCCESS;
+    }
+
+    *tree = TreeNode__new("", 1);
+
+    if (*tree == NULL)
+    {
+        fprintf(stderr, "Failed to create the tree\n");
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+/* Same as `sBuildRootNode`, also counting the expansions. Only used by one thread at a time */
+static int8_t sRunRuleAction(TreeNode **tree, CCB_production_t rule)
+{
+    sNumOfExpansions++;
+
+    return sBuildRootNode(tree, rule);
+}
+
+/* Nodes of the tree being built by `sBuildTree`, where node `i` is a child of node `i / 64` so
+no node has more than 64 children */
+#define TREE_FAN_OUT 64
+
+static TreeNode **sTreeNodes = NULL;
+static size_t sNumOfTreeNodes = 0;
+static size_t sTreeNodesCapacity = 0;
+
+/* Builds a node for every expansion, with `malloc` or in the arena of the parse */
+static int8_t sBuildTree(TreeNode **tree, CCB_production_t rule, ParseArena *arena)
+{
+    if (*tree == NULL)
+    {
+        sNumOfTreeNodes = 0;
+    }
+
+    if (sNumOfTreeNodes == sTreeNodesCapacity)
+    {
+        size_t newCapacity = sTreeNodesCapacity == 0 ? 1024 : 2 * sTreeNodesCapacity;
+        TreeNode **newTreeNodes = realloc(sTreeNodes, newCapacity * sizeof(TreeNode *));
+
+        if (newTreeNodes == NULL)
+        {
+            fprintf(stderr, "Failed to grow the tree nodes\n");
+            return CCB_ERROR;
+        }
+
+        sTreeNodes = newTreeNodes;
+        sTreeNodesCapacity = newCapacity;
+    }
+
+    TreeNode *node = ParseArena__newTreeNode(arena, &rule, sizeof(CCB_production_t));
+
+    if (node == NULL)
+    {
+        fprintf(stderr, "Failed to create a tree node\n");
+        return CCB_ERROR;
+    }
+
+    if (*tree == NULL)
+    {
+        *tree = node;
+    }
+    else if (ParseArena__insertTreeNode(arena,
+                                        sTreeNodes[sNumOfTreeNodes / TREE_FAN_OUT],
+                                        node) <= CCB_ERROR)
+    {
+        fprintf(stderr, "Failed to insert a tree node\n");
+        return CCB_ERROR;
+    }
+
+    sTreeNodes[sNumOfTreeNodes++] = node;
+
+    return CCB_SUCCESS;
+}
+
+static double sNow()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/* Peak resident set size of the process so far, in kilobytes */
+static long sPeakRss()
+{
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return -1;
+    }
+
+    return usage.ru_maxrss;
+}
+
+static void sPrintAllocations(size_t numOfAllocations)
+{
+    if (BenchAlloc__isCounting())
+    {
+        printf("%14zu", numOfAllocations);
+    }
+    else
+    {
+        printf("%14s", "n/a");
+    }
+}
+
+#define TABLE_PATH "ccabral_bench_table.bin"
+
+static void sPrintBuildRow(const BenchGrammar *grammar,
+                           const char *mode,
+                           double seconds,
+                           size_t numOfAllocations)
+{
+    printf("%-12s %-8s %12s %10.3f ms ", grammar->name, mode, "-", seconds * 1e3);
+    sPrintAllocations(numOfAllocations);
+    printf(" %10ld\n", sPeakRss());
+}
+
+/* Times building the parser from the grammar with `Parser__new`, and loading its saved table
+with `Parser__newFromTable` */
+static int sBenchmarkParserNew(const BenchGrammar *grammar,
+                               ProductionsHashMap *productions,
+                               unsigned numOfRepeats)
+{
+    double totalSeconds[2] = {0.0, 0.0};
+    size_t numOfAllocations[2] = {0, 0};
+
+    for (unsigned repeat = 0; repeat < numOfRepeats; repeat++)
+    {
+        size_t allocationsBefore = BenchAlloc__getCount();
+        double start = sNow();
+        Parser *parser = Parser__new(productions, sRunRuleAction, grammar->k);
+        totalSeconds[0] += sNow() - start;
+        numOfAllocations[0] = BenchAlloc__getCount() - allocationsBefore;
+
+        if (parser == NULL)
+        {
+            fprintf(stderr, "Failed to create the %s parser\n", grammar->name);
+            return EXIT_FAILURE;
+        }
+
+        int8_t saveResult = Parser__saveTable(parser, TABLE_PATH);
+        Parser__del(parser);
+
+        if (saveResult <= CCB_ERROR)
+        {
+            return EXIT_FAILURE;
+        }
+
+        allocationsBefore = BenchAlloc__getCount();
+        start = sNow();
+        parser = Parser__newFromTable(productions, sRunRuleAction, TABLE_PATH);
+        totalSeconds[1] += sNow() - start;
+        numOfAllocations[1] = BenchAlloc__getCount() - allocationsBefore;
+        remove(TABLE_PATH);
+
+        if (parser == NULL)
+        {
+            fprintf(stderr, "Failed to load the %s parser\n", grammar->name);
+            return EXIT_FAILURE;
+        }
+
+        Parser__del(parser);
+    }
+
+    sPrintBuildRow(grammar, "new", totalSeconds[0] / numOfRepeats, numOfAllocations[0]);
+    sPrintBuildRow(grammar, "load", totalSeconds[1] / numOfRepeats, numOfAllocations[1]);
+
+    return EXIT_SUCCESS;
+}
+
+/* Parses `tokens` `numOfRepeats` times in `mode` and keeps the fastest run */
+static int sBenchmarkParse(const BenchGrammar *grammar,
+                           Parser *parser,
+                           const CCB_terminal_t *tokens,
+                           size_t numOfTokens,
+                           const char *mode,
+                           unsigned numOfRepeats)
+{
+    bool isQueueMode = strcmp(mode, "queue") == 0;
+    double bestSeconds = -1.0;
+    size_t numOfAllocations = 0;
+
+    for (unsigned repeat = 0; repeat < numOfRepeats; repeat++)
+    {
+        TokenQueue *queue = NULL;
+
+        if (isQueueMode)
+        {
+            queue = TokenQueue__new();
+
+            if (queue == NULL ||
+                TokenQueue__enqueueMany(queue, tokens, numOfTokens) <= CCB_ERROR)
+            {
+                fprintf(stderr, "Failed to fill the token queue\n");
+                return EXIT_FAILURE;
+            }
+        }
+
+        sNumOfExpansions = 0;
+
+        size_t allocationsBefore = BenchAlloc__getCount();
+        double start = sNow();
+        TreeNode *tree = isQueueMode
+                             ? Parser__parse(parser, queue)
+                             : Parser__parseSpan(parser, tokens, numOfTokens);
+        double seconds = sNow() - start;
+        numOfAllocations = BenchAlloc__getCount() - allocationsBefore;
+
+        if (queue != NULL)
+        {
+            TokenQueue__del(queue);
+        }
+
+        if (tree == NULL)
+        {
+            fprintf(stderr,
+                    "Failed to parse %zu %s tokens in %s mode\n",
+                    numOfTokens,
+                    grammar->name,
+                    mode);
+            return EXIT_FAILURE;
+        }
+
+        TreeNode__del(tree);
+
+        if (bestSeconds < 0.0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    printf("%-12s %-8s %12zu %10.3f ms ",
+           grammar->name,
+           mode,
+           numOfTokens,
+           bestSeconds * 1e3);
+    sPrintAllocations(numOfAllocations);
+    printf(" %10ld %14.0f %12zu\n",
+           sPeakRss(),
+           (double)numOfTokens / bestSeconds,
+           sNumOfExpansions);
+
+    return EXIT_SUCCESS;
+}
+
+/* Parses `tokens` `numOfRepeats` times building a node for every expansion, and keeps the
+fastest run. The time includes releasing the tree, node by node with `TreeNode__del` in "tree"
+mode, or at once by resetting the arena in "arena" mode */
+static int sBenchmarkTree(const BenchGrammar *grammar,
+                          ParseContext *context,
+                          ParseArena *arena,
+                          const CCB_terminal_t *tokens,
+                          size_t numOfTokens,
+                          unsigned numOfRepeats)
+{
+    const char *mode = arena == NULL ? "tree" : "arena";
+    double bestSeconds = -1.0;
+    size_t numOfAllocations = 0;
+
+    ParseContext__setArena(context, arena);
+
+    for (unsigned repeat = 0; repeat < numOfRepeats; repeat++)
+    {
+        size_t allocationsBefore = BenchAlloc__getCount();
+        double start = sNow();
+        TreeNode *tree = ParseContext__parseSpan(context, tokens, numOfTokens);
+
+        if (tree == NULL)
+        {
+            fprintf(stderr,
+                    "Failed to parse %zu %s tokens in %s mode\n",
+                    numOfTokens,
+                    grammar->name,
+                    mode);
+            return EXIT_FAILURE;
+        }
+
+        if (arena == NULL)
+        {
+            TreeNode__del(tree);
+        }
+        else
+        {
+            ParseArena__reset(arena);
+        }
+
+        double seconds = sNow() - start;
+        numOfAllocations = BenchAlloc__getCount() - allocationsBefore;
+
+        if (bestSeconds < 0.0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    printf("%-12s %-8s %12zu %10.3f ms ",
+           grammar->name,
+           mode,
+           numOfTokens,
+           bestSeconds * 1e3);
+    sPrintAllocations(numOfAllocations);
+    printf(" %10ld %14.0f %12zu\n",
+           sPeakRss(),
+           (double)numOfTokens / bestSeconds,
+           sNumOfTreeNodes);
+
+    return EXIT_SUCCESS;
+}
+
+/* Listener of the events benchmark, counting the productions entered and exited */
+typedef struct BenchEvents
+{
+    size_t numOfEnters;
+    size_t numOfExits;
+    size_t numOfTokens;
+} BenchEvents;
+
+static int8_t sOnEnterProduction(void *context, CCB_production_t production)
+{
+    (void)production;
+    ((BenchEvents *)context)->numOfEnters++;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sOnToken(void *context, CCB_terminal_t terminal, size_t position)
+{
+    (void)terminal;
+    (void)position;
+    ((BenchEvents *)context)->numOfTokens++;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sOnExitProduction(void *context, CCB_production_t production)
+{
+    (void)production;
+    ((BenchEvents *)context)->numOfExits++;
+
+    return CCB_SUCCESS;
+}
+
+/* Parses `tokens` `numOfRepeats` times streaming the events to a counting listener instead of
+building a tree, and keeps the fastest run */
+static int sBenchmarkEvents(const BenchGrammar *grammar,
+                            ParseContext *context,
+                            const CCB_terminal_t *tokens,
+                            size_t numOfTokens,
+                            unsigned numOfRepeats)
+{
+    BenchEvents events;
+    ParseListener listener = {sOnEnterProduction, sOnToken, sOnExitProduction, &events};
+    double bestSeconds = -1.0;
+    size_t numOfAllocations = 0;
+
+    ParseContext__setListener(context, &listener);
+
+    for (unsigned repeat = 0; repeat < numOfRepeats; repeat++)
+    {
+        memset(&events, 0x0, sizeof(BenchEvents));
+
+        size_t allocationsBefore = BenchAlloc__getCount();
+        double start = sNow();
+        ParseContext__parseSpan(context, tokens, numOfTokens);
+        double seconds = sNow() - start;
+        numOfAllocations = BenchAlloc__getCount() - allocationsBefore;
+
+        if (ParseContext__getStatus(context) != CCB_SUCCESS ||
+            events.numOfEnters != events.numOfExits)
+        {
+            fprintf(stderr,
+                    "Failed to parse %zu %s tokens in events mode\n",
+                    numOfTokens,
+                    grammar->name);
+            ParseContext__setListener(context, NULL);
+            return EXIT_FAILURE;
+        }
+
+        if (bestSeconds < 0.0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    ParseContext__setListener(context, NULL);
+
+    printf("%-12s %-8s %12zu %10.3f ms ",
+           grammar->name,
+           "events",
+           numOfTokens,
+           bestSeconds * 1e3);
+    sPrintAllocations(numOfAllocations);
+    printf(" %10ld %14.0f %12zu\n",
+           sPeakRss(),
+           (double)numOfTokens / bestSeconds,
+           events.numOfEnters);
+
+    return EXIT_SUCCESS;
+}
+
+/* Parses `tokens` `numOfRepeats` times filling a concrete syntax tree instead of building a
+tree with the rule action, and keeps the fastest run. The tree is kept from one run to the next,
+as a context reused across parses would */
+static int sBenchmarkSyntaxTree(const BenchGrammar *grammar,
+                                ParseContext *context,
+                                ConcreteSyntaxTree *syntaxTree,
+                                const CCB_terminal_t *tokens,
+                                size_t numOfTokens,
+                                unsigned numOfRepeats)
+{
+    double bestSeconds = -1.0;
+    size_t numOfAllocations = 0;
+
+    ParseContext__setSyntaxTree(context, syntaxTree);
+
+    for (unsigned repeat = 0; repeat < numOfRepeats; repeat++)
+    {
+        size_t allocationsBefore = BenchAlloc__getCount();
+        double start = sNow();
+        ParseContext__parseSpan(context, tokens, numOfTokens);
+        double seconds = sNow() - start;
+        numOfAllocations = BenchAlloc__getCount() - allocationsBefore;
+
+        if (ParseContext__getStatus(context) != CCB_SUCCESS)
+        {
+            fprintf(stderr,
+                    "Failed to parse %zu %s tokens in cst mode\n",
+                    numOfTokens,
+                    grammar->name);
+            ParseContext__setSyntaxTree(context, NULL);
+            return EXIT_FAILURE;
+        }
+
+        if (bestSeconds < 0.0 || seconds < bestSeconds)
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    ParseContext__setSyntaxTree(context, NULL);
+
+    printf("%-12s %-8s %12zu %10.3f ms ",
+           grammar->name,
+           "cst",
+           numOfTokens,
+           bestSeconds * 1e3);
+    sPrintAllocations(numOfAllocations);
+    printf(" %10ld %14.0f %12zu\n",
+           sPeakRss(),
+           (double)numOfTokens / bestSeconds,
+           syntaxTree->numOfNodes - numOfTokens);
+
+    return EXIT_SUCCESS;
+}
+
+static int sBenchmarkGrammar(const BenchGrammar *grammar, const BenchOptions *options)
+{
+    ProductionsHashMap *productions = BenchGrammar__buildProductions(grammar);
+
+    if (productions == NULL)
+    {
+        fprintf(stderr, "Failed to build the %s productions\n", grammar->name);
+        return EXIT_FAILURE;
+    }
+
+    if (sBenchmarkParserNew(grammar, productions, options->numOfRepeats) != EXIT_SUCCESS)
+    {
+        HashMap__del(productions);
+        return EXIT_FAILURE;
+    }
+
+    Parser *parser = Parser__new(productions, sRunRuleAction, grammar->k);
+    Parser *treeParser = Parser__new(productions, NULL, grammar->k);
+    ParseContext *treeContext = treeParser == NULL ? NULL : ParseContext__new(treeParser);
+    Parser *eventsParser = Parser__new(productions, NULL, grammar->k);
+    ParseContext *eventsContext = eventsParser == NULL ? NULL : ParseContext__new(eventsParser);
+    ParseArena *arena = ParseArena__new(0);
+    ConcreteSyntaxTree *syntaxTree = ConcreteSyntaxTree__new(0);
+    CCB_terminal_t *tokens = malloc(options->maxNumOfTokens * sizeof(CCB_terminal_t));
+    int status = EXIT_SUCCESS;
+
+    if (parser == NULL ||
+        treeContext == NULL ||
+        eventsContext == NULL ||
+        arena == NULL ||
+        syntaxTree == NULL ||
+        tokens == NULL)
+    {
+        fprintf(stderr, "Failed to set up the %s benchmark\n", grammar->name);
+        status = EXIT_FAILURE;
+    }
+    else
+    {
+        Parser__setArenaRuleAction(treeParser, sBuildTree);
+    }
+
+    for (size_t maxNumOfTokens = options->minNumOfTokens;
+         status == EXIT_SUCCESS && maxNumOfTokens <= options->maxNumOfTokens;
+         maxNumOfTokens *= 10)
+    {
+        BenchRandom random = {options->seed};
+        size_t numOfTokens = grammar->generate(tokens, maxNumOfTokens, &random);
+
+        status = sBenchmarkParse(grammar,
+                                 parser,
+                                 tokens,
+                                 numOfTokens,
+                                 "span",
+                                 options->numOfRepeats);
+
+        if (status == EXIT_SUCCESS)
+        {
+            status = sBenchmarkParse(grammar,
+                                     parser,
+                                     tokens,
+                                     numOfTokens,
+                                     "queue",
+                                     options->numOfRepeats);
+        }
+
+        if (status == EXIT_SUCCESS)
+        {
+            status = sBenchmarkTree(grammar,
+                                    treeContext,
+                                    NULL,
+                                    tokens,
+                                    numOfTokens,
+                                    options->numOfRepeats);
+        }
+
+        if (status == EXIT_SUCCESS)
+        {
+            status = sBenchmarkTree(grammar,
+                                    treeContext,
+                                    arena,
+                                    tokens,
+                                    numOfTokens,
+                                    options->numOfRepeats);
+        }
+
+        if (status == EXIT_SUCCESS)
+        {
+            status = sBenchmarkEvents(grammar,
+                                      eventsContext,
+                                      tokens,
+                                      numOfTokens,
+                                      options->numOfRepeats);
+        }
+
+        if (status == EXIT_SUCCESS)
+        {
+            status = sBenchmarkSyntaxTree(grammar,
+                                          eventsContext,
+                                          syntaxTree,
+                                          tokens,
+                                          numOfTokens,
+                                          options->numOfRepeats);
+        }
+    }
+
+    free(tokens);
+
+    if (arena != NULL)
+    {
+        ParseArena__del(arena);
+    }
+
+    if (syntaxTree != NULL)
+    {
+        ConcreteSyntaxTree__del(syntaxTree);
+    }
+
+    if (treeContext != NULL)
+    {
+        ParseContext__del(treeContext);
+    }
+
+    if (eventsContext != NULL)
+    {
+        ParseContext__del(eventsContext);
+    }
+
+    if (eventsParser != NULL)
+    {
+        Parser__del(eventsParser);
+    }
+
+    if (treeParser != NULL)
+    {
+        Parser__del(treeParser);
+    }
+
+    if (parser != NULL)
+    {
+        Parser__del(parser);
+    }
+
+    HashMap__del(productions);
+
+    return status;
+}
+
+/* Thread of the threads benchmark, parsing the same tokens with its own context */
+typedef struct BenchThread
+{
+    pthread_t thread;
+    ParseContext *context;
+    const CCB_terminal_t *tokens;
+    size_t numOfTokens;
+    unsigned numOfRepeats;
+    bool hasFailed;
+} BenchThread;
+
+static void *sRunBenchThread(void *rawThread)
+{
+    BenchThread *thread = rawThread;
+
+    for (unsigned repeat = 0; repeat < thread->numOfRepeats; repeat++)
+    {
+        TreeNode *tree = ParseContext__parseSpan(thread->context,
+                                                 thread->tokens,
+                                                 thread->numOfTokens);
+
+        if (tree == NULL)
+        {
+            thread->hasFailed = true;
+            break;
+        }
+
+        TreeNode__del(tree);
+    }
+
+    return NULL;
+}
+
+/* Runs the first `numOfThreads` threads and returns the wall time until the last one ends, or
+a negative time if a parse failed */
+static double sTimeThreads(BenchThread *threads, unsigned numOfThreads)
+{
+    unsigned numOfStartedThreads = 0;
+    bool hasFailed = false;
+    double start = sNow();
+
+    for (; numOfStartedThreads < numOfThreads; numOfStartedThreads++)
+    {
+        BenchThread *thread = &threads[numOfStartedThreads];
+
+        thread->hasFailed = false;
+
+        if (pthread_create(&thread->thread, NULL, sRunBenchThread, thread) != 0)
+        {
+            fprintf(stderr, "Failed to start thread %u\n", numOfStartedThreads);
+            hasFailed = true;
+            break;
+        }
+    }
+
+    for (unsigned i = 0; i < numOfStartedThreads; i++)
+    {
+        pthread_join(threads[i].thread, NULL);
+        hasFailed = hasFailed || threads[i].hasFailed;
+    }
+
+    double seconds = sNow() - start;
+
+    return hasFailed ? -1.0 : seconds;
+}
+
+/* Doubles `numOfThreads`, ending with `maxNumOfThreads` even if it is not a power of 2 */
+static unsigned sNextNumOfThreads(unsigned numOfThreads, unsigned maxNumOfThreads)
+{
+    if (numOfThreads < maxNumOfThreads && numOfThreads * 2 > maxNumOfThreads)
+    {
+        return maxNumOfThreads;
+    }
+
+    return numOfThreads * 2;
+}
+
+/* Times parsing the same stream in 1, 2, 4 and so on up to `maxNumOfThreads` threads, which
+share one parser and own a context each. With the table shared, the tokens per second should
+grow with the number of threads up to the number of cores */
+static int sBenchmarkThreads(const BenchGrammar *grammar, const BenchOptions *options)
+{
+    ProductionsHashMap *productions = BenchGrammar__buildProductions(grammar);
+
+    if (productions == NULL)
+    {
+        fprintf(stderr, "Failed to build the %s productions\n", grammar->name);
+        return EXIT_FAILURE;
+    }
+
+    Parser *parser = Parser__new(productions, sBuildRootNode, grammar->k);
+    CCB_terminal_t *tokens = malloc(options->minNumOfTokens * sizeof(CCB_terminal_t));
+    BenchThread *threads = calloc(options->maxNumOfThreads, sizeof(BenchThread));
+    int status = EXIT_SUCCESS;
+
+    if (parser == NULL || tokens == NULL || threads == NULL)
+    {
+        fprintf(stderr, "Failed to set up the %s threads benchmark\n", grammar->name);
+        status = EXIT_FAILURE;
+    }
+
+    BenchRandom random = {options->seed};
+    size_t numOfTokens = status == EXIT_SUCCESS
+                             ? grammar->generate(tokens, options->minNumOfTokens, &random)
+                             : 0;
+
+    for (unsigned i = 0; status == EXIT_SUCCESS && i < options->maxNumOfThreads; i++)
+    {
+        threads[i].context = ParseContext__new(parser);
+        threads[i].tokens = tokens;
+        threads[i].numOfTokens = numOfTokens;
+        threads[i].numOfRepeats = options->numOfRepeats;
+
+        if (threads[i].context == NULL)
+        {
+            fprintf(stderr, "Failed to create the parse context of thread %u\n", i);
+            status = EXIT_FAILURE;
+        }
+    }
+
+    double singleThreadRate = 0.0;
+
+    for (unsigned numOfThreads = 1;
+         status == EXIT_SUCCESS && numOfThreads <= options->maxNumOfThreads;
+         numOfThreads = sNextNumOfThreads(numOfThreads, options->maxNumOfThreads))
+    {
+        double seconds = sTimeThreads(threads, numOfThreads);
+
+        if (seconds < 0.0)
+        {
+            fprintf(stderr,
+                    "Failed to parse %zu %s tokens in %u threads\n",
+                    numOfTokens,
+                    grammar->name,
+                    numOfThreads);
+            status = EXIT_FAILURE;
+            break;
+        }
+
+        double rate = (double)numOfTokens * options->numOfRepeats * numOfThreads / seconds;
+
+        if (numOfThreads == 1)
+        {
+            singleThreadRate = rate;
+        }
+
+        printf("%-12s %8u %12zu %10.3f ms %14.0f %9.2fx\n",
+               grammar->name,
+               numOfThreads,
+               numOfTokens,
+               seconds * 1e3,
+               rate,
+               rate / singleThreadRate);
+    }
+
+    for (unsigned i = 0; threads != NULL && i < options->maxNumOfThreads; i++)
+    {
+        if (threads[i].context != NULL)
+        {
+            ParseContext__del(threads[i].context);
+        }
+    }
+
+    free(threads);
+    free(tokens);
+
+    if (parser != NULL)
+    {
+        Parser__del(parser);
+    }
+
+    HashMap__del(productions);
+
+    return status;
+}
+
+static void sPrintUsage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [--grammar NAME] [--min-tokens N] [--max-tokens N] "
+            "[--repeat N] [--seed N] [--threads N]\n"
+            "Grammars:",
+            program);
+
+    for (size_t i = 0; i < kNumOfBenchGrammars; i++)
+    {
+        fprintf(stderr, " %s", kBenchGrammars[i].name);
+    }
+
+    fprintf(stderr, "\n");
+}
+
+static int8_t sParseOptions(int argc, char **argv, BenchOptions *options)
+{
+    for (int argIndex = 1; argIndex < argc; argIndex++)
+    {
+        const char *name = argv[argIndex];
+
+        if (argIndex + 1 >= argc)
+        {
+            return CCB_ERROR;
+        }
+
+        const char *value = argv[++argIndex];
+        char *end = NULL;
+        unsigned long long number = strtoull(value, &end, 10);
+        bool isNumber = end != value && *end == '\0';
+
+        if (strcmp(name, "--grammar") == 0)
+        {
+            options->grammarName = value;
+        }
+        else if (strcmp(name, "--min-tokens") == 0 && isNumber && number > 0)
+        {
+            options->minNumOfTokens = (size_t)number;
+        }
+        else if (strcmp(name, "--max-tokens") == 0 && isNumber && number > 0)
+        {
+            options->maxNumOfTokens = (size_t)number;
+        }
+        else if (strcmp(name, "--repeat") == 0 && isNumber && number > 0)
+        {
+            options->numOfRepeats = (unsigned)number;
+        }
+        else if (strcmp(name, "--seed") == 0 && isNumber && number > 0)
+        {
+            options->seed = (uint64_t)number;
+        }
+        else if (strcmp(name, "--threads") == 0 && isNumber && number > 0)
+        {
+            options->maxNumOfThreads = (unsigned)number;
+        }
+        else
+        {
+            return CCB_ERROR;
+        }
+    }
+
+    if (options->minNumOfTokens > options->maxNumOfTokens)
+    {
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options = {
+        NULL,
+        DEFAULT_MIN_NUM_OF_TOKENS,
+        DEFAULT_MAX_NUM_OF_TOKENS,
+        DEFAULT_NUM_OF_REPEATS,
+        DEFAULT_SEED,
+        0,
+    };
+
+    if (sParseOptions(argc, argv, &options) <= CCB_ERROR)
+    {
+        sPrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("%-12s %-8s %12s %13s %14s %10s %14s %12s\n",
+           "grammar",
+           "mode",
+           "tokens",
+           "time",
+           "allocations",
+           "rss (KB)",
+           "tokens/s",
+           "expansions");
+
+    bool isGrammarFound = false;
+
+    for (size_t i = 0; i < kNumOfBenchGrammars; i++)
+    {
+        const BenchGrammar *grammar = &kBenchGrammars[i];
+
+        if (options.grammarName != NULL && strcmp(options.grammarName, grammar->name) != 0)
+        {
+            continue;
+        }
+
+        isGrammarFound = true;
+
+        if (sBenchmarkGrammar(grammar, &options) != EXIT_SUCCESS)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!isGrammarFound)
+    {
+        fprintf(stderr, "Unknown grammar %s\n", options.grammarName);
+        sPrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options.maxNumOfThreads == 0)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    printf("\n%-12s %8s %12s %13s %14s %10s\n",
+           "grammar",
+           "threads",
+           "tokens",
+           "time",
+           "tokens/s",
+           "speedup");
+
+    for (size_t i = 0; i < kNumOfBenchGrammars; i++)
+    {
+        const BenchGrammar *grammar = &kBenchGrammars[i];
+
+        if (options.grammarName != NULL && strcmp(options.grammarName, grammar->name) != 0)
+        {
+            continue;
+        }
+
+        if (sBenchmarkThreads(grammar, &options) != EXIT_SUCCESS)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -342,7 +342,7 @@ int8_t runRuleAction(TreeNode **ast, CCB_production_t rule)
 
 int main()
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
 
     // 000111
     TokenQueue__enqueue(queue, ZERO_TR);
@@ -368,7 +368,7 @@ int main()
     TreeNode__del(tree);
     Parser__del(parser);
     HashMap__del(productions);
-    Queue__del(queue);
+    TokenQueue__del(queue);
 
     return EXIT_SUCCESS;
 }
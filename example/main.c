@@ -265,7 +265,7 @@ int8_t runRuleAction(TreeNode **ast, CCB_production_t rule)
 
 int main()
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
 
     // Enqueue: + + a a - a a $
     TokenQueue__enqueue(queue, PLUS_TR);
@@ -286,7 +286,7 @@ int main()
     TreeNode__del(tree);
     Parser__del(parser);
     ProductionsHashMap__del(productions);
-    Queue__del(queue);
+    TokenQueue__del(queue);
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,125 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <cbarroso/tree.h>
+#include <ccabral/constants.h>
+#include <ccabral/parser.h>
+#include <ccabral/tknsq.h>
+#include <ccabral/types.h>
+#include "static_example_gen.h"
+
+/* Same language as the ll2_example, but the tables are generated by ccabral-gen from
+`static_example.grammar` at build time, so creating the parser computes nothing */
+
+void printAstHelper(TreeNode *tree, const char *prefix, int isLast);
+
+/* Displays an ASCII representation of the abstract syntax tree */
+void printAst(TreeNode *tree)
+{
+    printAstHelper(tree, "", 1);
+}
+
+void printAstHelper(TreeNode *tree, const char *prefix, int isLast)
+{
+    if (tree == NULL)
+    {
+        return;
+    }
+
+    printf("%s", prefix);
+    printf("%s", isLast ? "└── " : "├── ");
+    printf("%s\n", (char *)tree->value);
+
+    SinglyLinkedListNode *current = tree->childrenHead;
+    int childCount = 0;
+    SinglyLinkedListNode *temp = current;
+    while (temp != NULL)
+    {
+        childCount++;
+        temp = temp->next;
+    }
+
+    int index = 0;
+    while (current != NULL)
+    {
+        TreeNode *child = (TreeNode *)current->value;
+        char newPrefix[256];
+        snprintf(newPrefix, sizeof(newPrefix), "%s%s", prefix, isLast ? "    " : "│   ");
+        printAstHelper(child, newPrefix, index == childCount - 1);
+        current = current->next;
+        index++;
+    }
+}
+
+int8_t runRuleOnlyAction(TreeNode **ast, CCB_production_t rule, char *label)
+{
+    TreeNode *newLeaf = TreeNode__new(label, strlen(label) + 1);
+
+    if (newLeaf == NULL)
+    {
+        fprintf(stderr, "Failed to create AST\n");
+        return CCB_ERROR;
+    }
+
+    if (*ast == NULL)
+    {
+        *ast = newLeaf;
+    }
+    else
+    {
+        if (TreeNode__insert(*ast, newLeaf) == CCB_ERROR)
+        {
+            fprintf(stderr, "Failed to insert node into AST\n");
+            TreeNode__del(newLeaf);
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+int8_t runRuleAction(TreeNode **ast, CCB_production_t rule)
+{
+    switch (rule)
+    {
+    case START_RULE_1_PR:
+    case START_RULE_2_PR:
+    case A_1_RULE_1_PR:
+    case A_1_RULE_2_PR:
+        return runRuleOnlyAction(ast, rule, "0");
+    case TAIL_RULE_1_PR:
+        return runRuleOnlyAction(ast, rule, "1");
+    }
+    return CCB_ERROR;
+}
+
+int main()
+{
+    TokenQueue *queue = TokenQueue__new();
+
+    // 000111
+    TokenQueue__enqueue(queue, ZERO_TR);
+    TokenQueue__enqueue(queue, ZERO_TR);
+    TokenQueue__enqueue(queue, ZERO_TR);
+    TokenQueue__enqueue(queue, ONE_TR);
+    TokenQueue__enqueue(queue, ONE_TR);
+    TokenQueue__enqueue(queue, ONE_TR);
+    TokenQueue__enqueue(queue, CCB_END_OF_TEXT_TR);
+
+    Parser *parser = StaticExampleParser__newStatic(runRuleAction);
+
+    if (parser == NULL)
+    {
+        fprintf(stderr, "Failed to create parser\n");
+        return EXIT_FAILURE;
+    }
+
+    TreeNode *tree = Parser__parse(parser, queue);
+    printAst(tree);
+
+    TreeNode__del(tree);
+    Parser__del(parser);
+    TokenQueue__del(queue);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,25 @@
+#ifndef CCABRAL__CHECKSUM_H
+#define CCABRAL__CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Starting value of `CCB_checksum` */
+#define CCB_CHECKSUM_SEED 0xcbf29ce484222325ULL
+
+/* Folds `size` bytes of `data` into `checksum` with 64-bit FNV-1a, so several buffers can be
+checksummed one after the other */
+static inline uint64_t CCB_checksum(uint64_t checksum, const void *data, size_t size)
+{
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        checksum ^= bytes[i];
+        checksum *= 0x100000001b3ULL;
+    }
+
+    return checksum;
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef CCABRAL__CST_H
+#define CCABRAL__CST_H
+
+#include <stddef.h>
+#include "constants.h"
+#include "cst.h"
+#include "types.h"
+
+/* Makes room for at least one more node */
+int8_t ConcreteSyntaxTree__reserve(ConcreteSyntaxTree *self);
+
+/* Appends a node after `previousSibling`, the last child of `parent` so far, or as the first
+child of `parent` if it is `CCB_NO_NODE`. Its token range starts and ends at `tokenStart`.
+Returns the index of the node, or `CCB_NO_NODE` if the arrays cannot grow */
+static inline size_t ConcreteSyntaxTree__addNode(ConcreteSyntaxTree *self,
+                                                 CCB_production_t production,
+                                                 CCB_terminal_t terminal,
+                                                 size_t parent,
+                                                 size_t previousSibling,
+                                                 size_t tokenStart)
+{
+    if (self->numOfNodes == self->capacity &&
+        ConcreteSyntaxTree__reserve(self) <= CCB_ERROR)
+    {
+        return CCB_NO_NODE;
+    }
+
+    size_t node = self->numOfNodes++;
+
+    self->productions[node] = production;
+    self->terminals[node] = terminal;
+    self->parents[node] = parent;
+    self->firstChildren[node] = CCB_NO_NODE;
+    self->nextSiblings[node] = CCB_NO_NODE;
+    self->tokenStarts[node] = tokenStart;
+    self->tokenEnds[node] = tokenStart;
+
+    if (previousSibling != CCB_NO_NODE)
+    {
+        self->nextSiblings[previousSibling] = node;
+    }
+    else if (parent != CCB_NO_NODE)
+    {
+        self->firstChildren[parent] = node;
+    }
+
+    return node;
+}
+
+#endif
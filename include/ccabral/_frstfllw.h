@@ -1,8 +1,11 @@
 #ifndef CCABRAL__FIRST_FOLLOW_H
 #define CCABRAL__FIRST_FOLLOW_H
 
+#include <stdbool.h>
 #include <stdlib.h>
+#include <cbarroso/dblylnkdlist.h>
 #include <cbarroso/sngllnkdlist.h>
+#include "_grmmdata.h"
 #include "constants.h"
 #include "prdcdata.h"
 #include "prdsmap.h"
@@ -10,18 +13,113 @@
 
 typedef SinglyLinkedListNode FirstFollowEntryNode;
 
+/* Set of terminals with one bit per terminal, so set operations work a 64-bit word at a
+time. The words are sized for the terminals of the grammar at hand */
+typedef struct TerminalSet
+{
+    uint64_t *words;
+    size_t numOfTerminals;
+} TerminalSet;
+
+static inline size_t TerminalSet__numOfWords(size_t numOfTerminals)
+{
+    return (numOfTerminals + 63) / 64;
+}
+
+/* Adds `terminal` to the set and returns whether it was not there yet */
+static inline bool TerminalSet__add(TerminalSet *self, CCB_terminal_t terminal)
+{
+    uint64_t bit = (uint64_t)1 << (terminal % 64);
+    bool wasAbsent = (self->words[terminal / 64] & bit) == 0;
+
+    self->words[terminal / 64] |= bit;
+
+    return wasAbsent;
+}
+
+static inline bool TerminalSet__contains(const TerminalSet *self, CCB_terminal_t terminal)
+{
+    return (self->words[terminal / 64] >> (terminal % 64)) & 1;
+}
+
+/* Adds the terminals of `other`, which has as many terminals, but the empty string to the set,
+and returns whether any was not there yet */
+static inline bool TerminalSet__unionNonEmpty(TerminalSet *self, const TerminalSet *other)
+{
+    uint64_t newBits = 0;
+    size_t numOfWords = TerminalSet__numOfWords(self->numOfTerminals);
+
+    for (size_t wordIndex = 0; wordIndex < numOfWords; wordIndex++)
+    {
+        uint64_t otherWord = other->words[wordIndex];
+
+        if (wordIndex == CCB_EMPTY_STRING_TR / 64)
+        {
+            otherWord &= ~((uint64_t)1 << (CCB_EMPTY_STRING_TR % 64));
+        }
+
+        newBits |= otherWord & ~self->words[wordIndex];
+        self->words[wordIndex] |= otherWord;
+    }
+
+    return newBits != 0;
+}
+
+/* Returns the lowest terminal of the set from `start` on, or `numOfTerminals` if there is
+none */
+static inline size_t TerminalSet__next(const TerminalSet *self, size_t start)
+{
+    for (size_t terminal = start; terminal < self->numOfTerminals;)
+    {
+        uint64_t word = self->words[terminal / 64] >> (terminal % 64);
+
+        if (word == 0)
+        {
+            terminal = (terminal / 64 + 1) * 64;
+            continue;
+        }
+
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            terminal++;
+        }
+
+        return terminal;
+    }
+
+    return self->numOfTerminals;
+}
+
 /* Holds the head and tail of a singly linked list of `k`-sized arrays */
 typedef struct FirstFollowEntry
 {
     FirstFollowEntryNode *entriesHead;
     FirstFollowEntryNode *entriesTail;
+
+    /* When `k == 1` the sequences are kept here instead of in the list, with the empty string
+    standing for the sequence of a nonterminal deriving to nothing */
+    TerminalSet terminals;
 } FirstFollowEntry;
 
-/* An array of `FirstFollowEntry`s */
-typedef FirstFollowEntry *FirstFollow;
+/* The `FirstFollowEntry` of each nonterminal, or `NULL` for the ones without productions */
+typedef struct FirstFollow
+{
+    size_t numOfNonterminals;
+    size_t numOfTerminals;
+    FirstFollowEntry *entries[];
+} FirstFollow;
 
+/* Creates a table with no entry yet for `numOfNonterminals` nonterminals. Its entries have
+room for `numOfTerminals` terminals in their set, which is 0 when the sequences are kept in the
+lists because `k > 1` */
+FirstFollow *FirstFollow__new(size_t numOfNonterminals, size_t numOfTerminals);
 void FirstFollow__del(FirstFollow *self);
-FirstFollowEntry *FirstFollowEntry__new();
+
+/* Creates an empty entry, with room in its terminal set for `numOfTerminals` terminals, or no
+terminal set at all when it is 0 */
+FirstFollowEntry *FirstFollowEntry__new(size_t numOfTerminals);
+void FirstFollowEntry__del(FirstFollowEntry *self);
 
 int8_t FirstFollowEntry__insert(
     FirstFollowEntry *self,
@@ -30,14 +128,72 @@ int8_t FirstFollowEntry__insert(
 
 char *FirstFollowEntry__str(FirstFollowEntry *self, uint8_t k);
 
+/* Inserts into `self` the first `k` terminals of every string the grammars from `grammarNode`
+to the end of its list derive to, reading the nonterminals from `first`. Strings shorter than
+`k` are completed with each sequence of `tail`, or inserted padded with empty strings if `tail`
+is `NULL`. Sets `*wasChangedPtr` to `true` if any sequence was not in `self` yet */
+int8_t FirstFollowEntry__insertDerivations(
+    FirstFollowEntry *self,
+    DoublyLinkedListNode *grammarNode,
+    FirstFollow *first,
+    FirstFollowEntry *tail,
+    uint8_t k,
+    bool *wasChangedPtr);
+
+/* Queue of the productions whose sets must be computed again, numbered by their position in a
+`ProductionsHashMap`. Each production is queued at most once at a time */
+typedef struct FirstFollowWorklist
+{
+    ProductionData **productions;
+    size_t numOfProductions;
+    size_t numOfNonterminals;
+
+    /* Productions to queue again when the set of the nonterminal `nt` grows are
+    `dependents[dependentOffsets[nt]]` to `dependents[dependentOffsets[nt + 1] - 1]` */
+    size_t *dependentOffsets;
+    size_t *dependents;
+
+    /* Circular queue of production indexes */
+    size_t *queue;
+    size_t queueHead;
+    size_t queueSize;
+    bool *isQueued;
+} FirstFollowWorklist;
+
+/* Creates a worklist with every production queued. The productions depending on a nonterminal
+are the ones using it in their right hand side if `dependsOnRightHand`, or its own productions
+otherwise. The nonterminals of `productions` must be below `numOfNonterminals` */
+FirstFollowWorklist *FirstFollowWorklist__new(
+    ProductionsHashMap *productions,
+    size_t numOfNonterminals,
+    bool dependsOnRightHand);
+
+/* Takes the next queued production, returning `false` when there is none */
+bool FirstFollowWorklist__pop(FirstFollowWorklist *self, ProductionData **productionPtr);
+
+/* Queues the productions depending on `nonterminal` that are not queued yet */
+void FirstFollowWorklist__pushDependents(
+    FirstFollowWorklist *self,
+    CCB_nonterminal_t nonterminal);
+
+void FirstFollowWorklist__del(FirstFollowWorklist *self);
+
 /* Creates the FIRST table: a table mapping each nonterminal to the first `k`
-terminals each of its rules derive to */
-FirstFollow *First__new(ProductionsHashMap *productions, uint8_t k);
+terminals each of its rules derive to. Sequences shorter than `k` are padded with empty
+strings. The sets grow until none changes, revisiting only the productions using a nonterminal
+whose set grew. The grammars of `productions` must be below `numOfNonterminals` and
+`numOfTerminals` */
+FirstFollow *First__new(
+    ProductionsHashMap *productions,
+    size_t numOfNonterminals,
+    size_t numOfTerminals,
+    uint8_t k);
 
 /* Creates the FOLLOW table: a table mapping each nonterminal to `k`
 terminals. It looks into all productions that nonterminal appears in the right hand
 side. If there are up to `k` terminals after or that the nonterminals after it derive
-to, they will be mapped to it */
+to, they will be mapped to it, completed with the FOLLOW of the production's left hand side
+when there are less than `k`. It is sized as `first` */
 FirstFollow *Follow__new(
     ProductionsHashMap *productions,
     FirstFollow *first,
@@ -0,0 +1,14 @@
+#ifndef CCABRAL__GRAMMAR_H
+#define CCABRAL__GRAMMAR_H
+
+#include "_prdcprsntble.h"
+#include "_prdstble.h"
+#include "grmmr.h"
+
+typedef struct Grammar
+{
+    PrdcPrsnTble *prdcPrsnTble;
+    ProductionsTable *productionsTable;
+} Grammar;
+
+#endif
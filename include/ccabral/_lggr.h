@@ -0,0 +1,78 @@
+#ifndef CCABRAL__LOGGER_H
+#define CCABRAL__LOGGER_H
+
+#include <clinschoten/constants.h>
+#include <clinschoten/logger.h>
+
+/* Log levels usable in `#if`, matching the clinschoten ones */
+#define CCB_DEBUG_LL 10
+#define CCB_INFO_LL 20
+#define CCB_WARNING_LL 30
+#define CCB_ERROR_LL 40
+#define CCB_CRITICAL_LL 50
+#define CCB_OFF_LL 255
+
+/* Lowest level compiled into the library. Messages below it are removed by the preprocessor,
+along with their arguments */
+#ifndef CCB_LOG_LEVEL
+#define CCB_LOG_LEVEL CCB_ERROR_LL
+#endif
+
+/* Modules with their own cached logger */
+typedef enum CCB_logmodule_t
+{
+    CCB_FIRST_LM,
+    CCB_FOLLOW_LM,
+    CCB_GRAMMAR_LM,
+    CCB_PRDCPRSNTBLE_LM,
+    CCB_PRDSMAP_LM,
+    CCB_PARSER_LM,
+    CCB_NUM_OF_LOG_MODULES,
+} CCB_logmodule_t;
+
+/* Returns the logger of `module`, or `NULL` if it could not be created. Every logger is created
+on the first call, only once even when several threads make it at the same time, and lives until
+the program exits */
+ClnLogger *CCB_getLogger(CCB_logmodule_t module);
+
+#define CCB_LOG(module, level, ...)                         \
+    do                                                      \
+    {                                                       \
+        ClnLogger *ccbLogger = CCB_getLogger(module);       \
+        if (ccbLogger != NULL)                              \
+        {                                                   \
+            ClnLogger__log(ccbLogger, level, __VA_ARGS__);  \
+        }                                                   \
+    } while (0)
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+#define CCB_LOG_DEBUG(module, ...) CCB_LOG(module, CLN_DEBUG_LL, __VA_ARGS__)
+#else
+#define CCB_LOG_DEBUG(module, ...) ((void)0)
+#endif
+
+#if CCB_LOG_LEVEL <= CCB_INFO_LL
+#define CCB_LOG_INFO(module, ...) CCB_LOG(module, CLN_INFO_LL, __VA_ARGS__)
+#else
+#define CCB_LOG_INFO(module, ...) ((void)0)
+#endif
+
+#if CCB_LOG_LEVEL <= CCB_WARNING_LL
+#define CCB_LOG_WARNING(module, ...) CCB_LOG(module, CLN_WARNING_LL, __VA_ARGS__)
+#else
+#define CCB_LOG_WARNING(module, ...) ((void)0)
+#endif
+
+#if CCB_LOG_LEVEL <= CCB_ERROR_LL
+#define CCB_LOG_ERROR(module, ...) CCB_LOG(module, CLN_ERROR_LL, __VA_ARGS__)
+#else
+#define CCB_LOG_ERROR(module, ...) ((void)0)
+#endif
+
+#if CCB_LOG_LEVEL <= CCB_CRITICAL_LL
+#define CCB_LOG_CRITICAL(module, ...) CCB_LOG(module, CLN_CRITICAL_LL, __VA_ARGS__)
+#else
+#define CCB_LOG_CRITICAL(module, ...) ((void)0)
+#endif
+
+#endif
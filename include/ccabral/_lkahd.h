@@ -0,0 +1,61 @@
+#ifndef CCABRAL__LOOKAHEAD_H
+#define CCABRAL__LOOKAHEAD_H
+
+#include <stdint.h>
+#include "constants.h"
+#include "types.h"
+
+/* Circular window over the next `k` tokens of the input. Every token is written twice, `k`
+positions apart, into a buffer of `2 * k` tokens, so the window starting at `head` is always
+contiguous and consuming a token never shifts the others */
+typedef struct Lookahead
+{
+    CCB_terminal_t *tokens;
+    uint8_t head;
+    uint8_t k;
+} Lookahead;
+
+/* Starts a window made only of end of texts over `buffer`, which must hold `2 * k` tokens */
+static inline void Lookahead__init(Lookahead *self, CCB_terminal_t *buffer, uint8_t k)
+{
+    for (uint16_t i = 0; i < 2 * k; i++)
+    {
+        buffer[i] = CCB_END_OF_TEXT_TR;
+    }
+
+    self->tokens = buffer;
+    self->head = 0;
+    self->k = k;
+}
+
+/* Returns the `k` tokens of the window, in input order */
+static inline const CCB_terminal_t *Lookahead__window(const Lookahead *self)
+{
+    return &self->tokens[self->head];
+}
+
+/* Returns the `index`-th token of the window */
+static inline CCB_terminal_t Lookahead__get(const Lookahead *self, uint8_t index)
+{
+    return self->tokens[self->head + index];
+}
+
+/* Replaces the `index`-th token of the window with `token` */
+static inline void Lookahead__set(Lookahead *self, uint8_t index, CCB_terminal_t token)
+{
+    /* Up to `2 * k - 2`, past what a `uint8_t` holds once k is over 128 */
+    uint16_t position = (uint16_t)(self->head + index);
+
+    self->tokens[position] = token;
+    self->tokens[position < self->k ? position + self->k : position - self->k] = token;
+}
+
+/* Drops the first token of the window and appends `token` to its end */
+static inline void Lookahead__push(Lookahead *self, CCB_terminal_t token)
+{
+    self->tokens[self->head] = token;
+    self->tokens[self->head + self->k] = token;
+    self->head = self->head + 1 == self->k ? 0 : self->head + 1;
+}
+
+#endif
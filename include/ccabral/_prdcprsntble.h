@@ -1,15 +1,83 @@
 #ifndef CCABRAL_PREDICTIVE_PARSING_TABLE_H
 #define CCABRAL_PREDICTIVE_PARSING_TABLE_H
 
+#include <stdbool.h>
+#include <stdio.h>
 #include <cbarroso/hashmap.h>
 #include "_prdsmap.h"
+#include "constants.h"
 #include "prdcdata.h"
 #include "types.h"
 
-typedef HashMap *PrdcPrsnTble;
+/* A state of the prediction trie compiled for `k > 1`. Each state is reached by consuming one
+lookahead token per depth */
+typedef struct PrdcTrieNode
+{
+    /* Production predicted when the lookahead read so far is followed by empty strings, or
+    `CCB_ERROR_PR` if there is none */
+    CCB_production_t production;
 
+    /* Whether `production` is the only prediction reachable from this state, so the remaining
+    lookahead does not need to be read */
+    bool isDecisive;
+} PrdcTrieNode;
+
+typedef struct PrdcPrsnTble
+{
+    uint8_t k;
+
+    /* Sizes of the grammar the table was built for, which every array below is sized by. Both
+    are one past the highest id the grammar uses */
+    size_t numOfNonterminals;
+    size_t numOfTerminals;
+
+    /* An array of `numOfNonterminals` `HashMap`s, each mapping a `k`-sized terminal sequence to a
+    production. Only used when `k > 1` */
+    HashMap **kSeqMaps;
+
+    /* Flat `[numOfNonterminals][numOfTerminals]` array of productions, with `CCB_ERROR_PR` for
+    the empty cells. Only used when `k == 1` */
+    CCB_production_t *ll1Table;
+
+    /* States of the prediction tries compiled from `kSeqMaps`. The state 0 is never reached and
+    marks missing transitions. Only used when `k > 1` */
+    PrdcTrieNode *trieNodes;
+    uint32_t numOfTrieNodes;
+
+    /* Flat `[numOfTrieNodes][numOfTerminals]` array mapping each state and next token to the
+    index of the next state, with 0 meaning there is no transition */
+    uint32_t *trieChildren;
+
+    /* Maps each nonterminal to the index of its root state in `trieNodes` */
+    uint32_t *trieRoots;
+
+    /* File the table was loaded from, which `ll1Table`, `trieNodes`, `trieChildren` and
+    `trieRoots` point into, or `NULL` if the table was built in memory */
+    void *mapping;
+    size_t mappingSize;
+} PrdcPrsnTble;
+
+/* Builds the table of the grammar in `productions`, sized for the highest nonterminal and
+terminal ids it uses */
 PrdcPrsnTble *PrdcPrsnTble__new(ProductionsHashMap *productions, uint8_t k);
 
+/* Writes the table into the file at `path`. The file starts with a versioned header, holding
+`grammarHash` and a checksum of the rest, followed by the dense LL(1) table or the prediction
+trie exactly as they are laid out in memory */
+int8_t PrdcPrsnTble__save(const PrdcPrsnTble *self, uint64_t grammarHash, const char *path);
+
+/* Maps a table written by `PrdcPrsnTble__save` into memory and uses it in place. Fails if the
+file is corrupted, was written for another grammar than `grammarHash`, or by a build with other
+type widths. Since the checksum is stored along with the data, the table must also be sized for
+the `numOfNonterminals` of the grammar and only predict its `numOfProductions` productions, so a
+forged file cannot make the parser read past the grammar. Loaded tables only predict, so
+`PrdcPrsnTble__setItem` must not be called on them */
+PrdcPrsnTble *PrdcPrsnTble__load(
+    const char *path,
+    uint64_t grammarHash,
+    size_t numOfNonterminals,
+    size_t numOfProductions);
+
 int8_t PrdcPrsnTble__getItem(
     PrdcPrsnTble *self,
     CCB_nonterminal_t nonterminal,
@@ -17,6 +85,52 @@ int8_t PrdcPrsnTble__getItem(
     uint8_t k,
     CCB_production_t *production);
 
+/* Returns the production predicted for `nonterminal` when `terminal` is the lookahead, or
+`CCB_ERROR_PR` if there is none, which includes terminals the grammar does not use. Only valid
+for tables built with `k == 1` */
+static inline CCB_production_t PrdcPrsnTble__getLL1Item(
+    const PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    CCB_terminal_t terminal)
+{
+    if (terminal >= self->numOfTerminals)
+    {
+        return CCB_ERROR_PR;
+    }
+
+    return self->ll1Table[(size_t)nonterminal * self->numOfTerminals + terminal];
+}
+
+/* Returns the state reached from the trie state `nodeIndex` by consuming `terminal`, or 0 if
+there is none */
+static inline uint32_t PrdcPrsnTble__getTrieChild(
+    const PrdcPrsnTble *self,
+    uint32_t nodeIndex,
+    CCB_terminal_t terminal)
+{
+    if (terminal >= self->numOfTerminals)
+    {
+        return 0;
+    }
+
+    return self->trieChildren[(size_t)nodeIndex * self->numOfTerminals + terminal];
+}
+
+/* Returns the production predicted for `nonterminal` given the `k` tokens of `lookahead`, or
+`CCB_ERROR_PR` if there is none. The longest lookahead prefix with an entry in the table wins,
+and its length is written into `prefixLengthPtr` */
+CCB_production_t PrdcPrsnTble__predict(
+    const PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    const CCB_terminal_t *lookahead,
+    uint8_t *prefixLengthPtr);
+
+/* Writes the lookahead sequences `nonterminal` has a production for into `stream` */
+void PrdcPrsnTble__printOptions(
+    PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    FILE *stream);
+
 void PrdcPrsnTble__del(PrdcPrsnTble *self);
 
 #endif
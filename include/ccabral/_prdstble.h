@@ -0,0 +1,54 @@
+#ifndef CCABRAL__PRODUCTIONS_TABLE_H
+#define CCABRAL__PRODUCTIONS_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "_grmmdata.h"
+#include "_prdsmap.h"
+#include "types.h"
+
+/* Compiled form of a `ProductionsHashMap`, indexed by production id */
+typedef struct ProductionsTable
+{
+    /* One past the highest production id */
+    size_t numOfProductions;
+
+    /* Left hand nonterminal of each production */
+    CCB_nonterminal_t *leftHands;
+
+    /* Offset of each production's right hand side in `rightHands` */
+    uint32_t *rightHandOffsets;
+
+    /* Number of grammars in each production's right hand side. Empty strings are not stored, so
+    it is 0 for productions deriving the empty string */
+    uint8_t *rightHandLengths;
+
+    /* Right hand sides of all productions, each one stored in reverse order so it can be pushed
+    onto the parser stack as it is */
+    GrammarData *rightHands;
+} ProductionsTable;
+
+ProductionsTable *ProductionsTable__new(ProductionsHashMap *productions);
+
+/* Returns the reversed right hand side of `production` and writes its length into
+`lengthPtr` */
+static inline const GrammarData *ProductionsTable__getRightHand(
+    const ProductionsTable *self,
+    CCB_production_t production,
+    uint8_t *lengthPtr)
+{
+    *lengthPtr = self->rightHandLengths[production];
+    return &self->rightHands[self->rightHandOffsets[production]];
+}
+
+/* One past the highest nonterminal id the productions use, counting the start nonterminal, as
+the predictive parsing table of the grammar is sized */
+size_t ProductionsTable__getNumOfNonterminals(const ProductionsTable *self);
+
+/* Returns a checksum of every production, so tables saved for a grammar are not loaded for
+another one */
+uint64_t ProductionsTable__hash(const ProductionsTable *self);
+
+void ProductionsTable__del(ProductionsTable *self);
+
+#endif
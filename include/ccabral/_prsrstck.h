@@ -1,17 +1,74 @@
 #ifndef CCABRAL__PRSRSTCK_H
 #define CCABRAL__PRSRSTCK_H
 
+#include <stddef.h>
 #include "_grmmdata.h"
+#include "constants.h"
 #include "types.h"
-#include <cbarroso/stack.h>
 
-typedef Stack ParserStack;
+/* Growable array of packed `GrammarData`s, with the top of the stack at
+`grammars[stackSize - 1]` */
+typedef struct ParserStack
+{
+    GrammarData *grammars;
+    size_t stackSize;
+    size_t capacity;
+
+#ifdef CCB_ENABLE_STATS
+    /* Allocations made by the stack since it was created */
+    size_t numOfAllocations;
+#endif
+} ParserStack;
 
 ParserStack *ParserStack__new();
-int8_t ParserStack__push(ParserStack *self,
-                         CCB_grammar_t newValue,
-                         CCB_grammartype_t grammarType);
-int8_t ParserStack__pop(ParserStack *self,
-                        GrammarData **value);
+
+/* Makes room for at least `numOfGrammars` more grammars */
+int8_t ParserStack__reserve(ParserStack *self, size_t numOfGrammars);
+
+static inline int8_t ParserStack__push(ParserStack *self,
+                                       CCB_grammar_t newValue,
+                                       CCB_grammartype_t grammarType)
+{
+    if (self->stackSize == self->capacity &&
+        ParserStack__reserve(self, 1) <= CCB_ERROR)
+    {
+        return CCB_ERROR;
+    }
+
+    self->grammars[self->stackSize].id = newValue;
+    self->grammars[self->stackSize].type = grammarType;
+    self->stackSize++;
+
+    return CCB_SUCCESS;
+}
+
+/* Pushes `numOfGrammars` grammars in order, so the last one ends up on top */
+int8_t ParserStack__pushMany(ParserStack *self,
+                             const GrammarData *grammars,
+                             size_t numOfGrammars);
+
+static inline int8_t ParserStack__pop(ParserStack *self,
+                                      GrammarData *value)
+{
+    if (self->stackSize == 0)
+    {
+        return CCB_ERROR;
+    }
+
+    *value = self->grammars[--self->stackSize];
+
+    return CCB_SUCCESS;
+}
+
+/* Empties the stack down to the end of text at its bottom, keeping its memory for the next
+parse */
+static inline void ParserStack__reset(ParserStack *self)
+{
+    self->grammars[0].id = CCB_END_OF_TEXT_TR;
+    self->grammars[0].type = CCB_TERMINAL_GT;
+    self->stackSize = 1;
+}
+
+void ParserStack__del(ParserStack *self);
 
 #endif
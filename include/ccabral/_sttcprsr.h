@@ -0,0 +1,14 @@
+#ifndef CCABRAL__STATIC_PARSER_H
+#define CCABRAL__STATIC_PARSER_H
+
+#include "_prdcprsntble.h"
+#include "_prdstble.h"
+#include "parser.h"
+
+/* Creates a parser over tables it does not own, such as the `static const` ones emitted by
+ccabral-gen. The tables must outlive the parser, and `Parser__del` never frees them */
+Parser *Parser__newFromTables(const PrdcPrsnTble *prdcPrsnTble,
+                              const ProductionsTable *productionsTable,
+                              RunRuleActionCallback runRuleAction);
+
+#endif
@@ -11,11 +11,15 @@
 #define CCB_NONTERMINAL_GT (CCB_grammartype_t)0
 #define CCB_TERMINAL_GT (CCB_grammartype_t)1
 
+/* Grammar sizes. Each grammar sizes its tables for the ids it uses, so these only bound the ids
+a build accepts and the scratch sets of the table construction. They default to what the id
+widths can hold, up to 65536 */
+
 // Nonterminals
 #define CCB_START_NT (CCB_nonterminal_t)0
 
 #ifndef CCB_NUM_OF_NONTERMINALS
-#define CCB_NUM_OF_NONTERMINALS 1
+#define CCB_NUM_OF_NONTERMINALS (CCB_NONTERMINAL_BITS == 8 ? 256 : 65536)
 #endif
 
 // Terminals
@@ -23,14 +27,27 @@
 #define CCB_END_OF_TEXT_TR (CCB_terminal_t)1
 
 #ifndef CCB_NUM_OF_TERMINALS
-#define CCB_NUM_OF_TERMINALS 2
+#define CCB_NUM_OF_TERMINALS (CCB_TERMINAL_BITS == 8 ? 256 : 65536)
 #endif
 
 // Productions
 #define CCB_ERROR_PR (CCB_production_t) - 1
 
 #ifndef CCB_NUM_OF_PRODUCTIONS
-#define CCB_NUM_OF_PRODUCTIONS 0
+#define CCB_NUM_OF_PRODUCTIONS (CCB_PRODUCTION_BITS == 8 ? 128 : 32768)
+#endif
+
+// Id widths, see types.h
+#if CCB_TERMINAL_BITS < 32 && CCB_NUM_OF_TERMINALS > (1 << CCB_TERMINAL_BITS)
+#error "CCB_TERMINAL_BITS is too narrow for CCB_NUM_OF_TERMINALS"
+#endif
+
+#if CCB_NONTERMINAL_BITS < 32 && CCB_NUM_OF_NONTERMINALS > (1 << CCB_NONTERMINAL_BITS)
+#error "CCB_NONTERMINAL_BITS is too narrow for CCB_NUM_OF_NONTERMINALS"
+#endif
+
+#if CCB_PRODUCTION_BITS < 32 && CCB_NUM_OF_PRODUCTIONS > (1 << (CCB_PRODUCTION_BITS - 1))
+#error "CCB_PRODUCTION_BITS is too narrow for CCB_NUM_OF_PRODUCTIONS"
 #endif
 
 #endif
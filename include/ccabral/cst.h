@@ -0,0 +1,46 @@
+#ifndef CCABRAL_CST_H
+#define CCABRAL_CST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "types.h"
+
+/* Index of no node, for the parent of the root and the children and siblings a node lacks */
+#define CCB_NO_NODE (size_t) - 1
+
+/* Concrete syntax tree kept as parallel arrays indexed by node, filled by the parses of a
+context it is set on with `ParseContext__setSyntaxTree`. Nodes are stored in preorder, with the
+root at index 0, so walking the arrays in order visits the tree depth first without following
+any pointer. The arrays are grown as needed and kept from one parse to the next, and must only
+be read */
+typedef struct ConcreteSyntaxTree
+{
+    /* Production expanded at each node, or `CCB_ERROR_PR` for the terminals */
+    CCB_production_t *productions;
+
+    /* Terminal matched at each node, or `CCB_EMPTY_STRING_TR` for the productions */
+    CCB_terminal_t *terminals;
+
+    size_t *parents;
+    size_t *firstChildren;
+    size_t *nextSiblings;
+
+    /* Position in the input of the first token of each node, and of the one after its last, so
+    nodes of epsilon productions have empty ranges. In parses of token records, the record of a
+    terminal node is the one at its first position */
+    size_t *tokenStarts;
+    size_t *tokenEnds;
+
+    size_t numOfNodes;
+    size_t capacity;
+} ConcreteSyntaxTree;
+
+/* Creates an empty tree with room for `capacity` nodes, or a default number if it is 0 */
+ConcreteSyntaxTree *ConcreteSyntaxTree__new(size_t capacity);
+
+/* Removes every node, keeping the arrays for the next parse */
+void ConcreteSyntaxTree__clear(ConcreteSyntaxTree *self);
+
+void ConcreteSyntaxTree__del(ConcreteSyntaxTree *self);
+
+#endif
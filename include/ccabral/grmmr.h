@@ -0,0 +1,29 @@
+#ifndef CCABRAL_GRAMMAR_H
+#define CCABRAL_GRAMMAR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "prdsmap.h"
+
+/* A grammar compiled into the tables its parsers read, sized for its own number of
+nonterminals, terminals and productions. Grammars of any size can live side by side in a
+process, and every parser created from one shares its tables */
+typedef struct Grammar Grammar;
+
+/* Compiles the productions of `productions` into an LL(`k`) grammar. `productions` is not
+referenced after the call returns */
+Grammar *Grammar__new(ProductionsHashMap *productions, uint8_t k);
+
+/* Compiles `productions` with the predictive parsing table saved by `Parser__saveTable` at
+`tablePath` instead of computing it again. `k` is read from the file */
+Grammar *Grammar__newFromTable(ProductionsHashMap *productions, const char *tablePath);
+
+/* One past the highest nonterminal, terminal and production ids of the grammar */
+size_t Grammar__getNumOfNonterminals(const Grammar *self);
+size_t Grammar__getNumOfTerminals(const Grammar *self);
+size_t Grammar__getNumOfProductions(const Grammar *self);
+
+/* Frees the grammar and its tables, so every parser created from it must be deleted first */
+void Grammar__del(Grammar *self);
+
+#endif
@@ -1,20 +1,257 @@
 #ifndef CCABRAL_PARSER_H
 #define CCABRAL_PARSER_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <cbarroso/tree.h>
+#include "cst.h"
+#include "grmmr.h"
 #include "prdcdata.h"
 #include "prdsmap.h"
+#include "prsarn.h"
+#include "tknrcrd.h"
 #include "tknsq.h"
+#include "tknsrc.h"
 
+/* Rule action run on every production the parse expands, receiving the tree being built.
+Returning `CCB_ERROR` stops the parse, which then fails */
 typedef int8_t (*RunRuleActionCallback)(TreeNode **, CCB_production_t);
 
+/* Rule action that also receives the arena of the parse, or `NULL` if it has none, to build the
+tree with `ParseArena__newTreeNode` and `ParseArena__insertTreeNode`. Returning `CCB_ERROR`
+stops the parse, which then fails */
+typedef int8_t (*RunArenaRuleActionCallback)(TreeNode **, CCB_production_t, ParseArena *);
+
+/* Hook of one production, receiving the tree being built and the context set with
+`ParseContext__setActionContext`. Returning `CCB_ERROR` stops the parse, which then fails */
+typedef int8_t (*ProductionActionCallback)(TreeNode **tree,
+                                           CCB_production_t production,
+                                           void *context);
+
+/* Hook run on every terminal the parse matches, receiving the tree being built, the token and
+the context set with `ParseContext__setActionContext`. Returning `CCB_ERROR` stops the parse,
+which then fails */
+typedef int8_t (*TokenActionCallback)(TreeNode **tree, const TokenRecord *token, void *context);
+
+/* Hooks run when a production is expanded and once its right hand side is consumed. Either may
+be `NULL`, in which case nothing is called */
+typedef struct ProductionActions
+{
+    ProductionActionCallback onEnter;
+    ProductionActionCallback onExit;
+} ProductionActions;
+
+/* Events of a parse, sent in the order of a preorder walk of the tree it would build: the entry
+of each production the parser expands, the terminals it matches with their position in the
+input, and the exit of each production once its right hand side is consumed. Any callback may be
+`NULL`, and one returning `CCB_ERROR` stops the parse, which then fails */
+typedef struct ParseListener
+{
+    int8_t (*onEnterProduction)(void *context, CCB_production_t production);
+    int8_t (*onToken)(void *context, CCB_terminal_t terminal, size_t position);
+    int8_t (*onExitProduction)(void *context, CCB_production_t production);
+
+    /* Passed to every callback */
+    void *context;
+} ParseListener;
+
 typedef struct Parser Parser;
 
+/* Number of lookahead prefix lengths `ParserStats` tells apart */
+#define CCB_STATS_MAX_PREFIX_LENGTH 8
+
+/* Counters gathered by the parses of a parser. They are only updated when the library is built
+with `CCB_ENABLE_STATS` */
+typedef struct ParserStats
+{
+    /* Productions expanded */
+    size_t numOfExpansions;
+
+    /* Terminals at the top of the stack matched with the lookahead */
+    size_t numOfMatches;
+
+    /* Successful table lookups, by the length of the lookahead prefix that decided them, with
+    `numOfLookups[i]` counting the prefixes of `i + 1` tokens. Longer prefixes are counted in the
+    last slot */
+    size_t numOfLookups[CCB_STATS_MAX_PREFIX_LENGTH];
+
+    /* Highest number of grammars in the parser stack */
+    size_t maxStackDepth;
+
+    /* Tokens read from the input, including the ones only used as lookahead */
+    size_t numOfTokens;
+
+    /* Allocations made by the parser itself, without the ones of the rule actions */
+    size_t numOfAllocations;
+} ParserStats;
+
+/* Mutable state of the parses of a parser: its stack, lookahead window, tree being built and
+counters. Parses run through a context never modify the parser, so threads can share one parser
+with a context each. A context runs one parse at a time, and keeps its memory from one parse to
+the next */
+typedef struct ParseContext ParseContext;
+
+/* Creates a parser owning a grammar compiled as `Grammar__new` does. `productions` is not
+referenced after the call returns */
 Parser *Parser__new(ProductionsHashMap *productions,
                     RunRuleActionCallback runRuleAction,
                     uint8_t k);
+
+/* Creates a parser reading the tables of `grammar` instead of owning a copy of them, so parsers
+of the same grammar only add their own state. `grammar` must outlive the parser */
+Parser *Parser__newFromGrammar(const Grammar *grammar, RunRuleActionCallback runRuleAction);
+
+/* Replaces the rule action of the parser with one receiving the arena of each parse. It must be
+set before the parser is shared */
+void Parser__setArenaRuleAction(Parser *self, RunArenaRuleActionCallback runArenaRuleAction);
+
+/* Replaces the rule action of the parser with a copy of `actions`, indexed by production id, so
+each expansion calls the hook of its production without going through a switch. Productions
+from `numOfActions` on have no hooks, and a `NULL` table removes them all. Exits are only
+tracked when some production has an exit hook. It must be set before the parser is shared */
+int8_t Parser__setProductionActions(Parser *self,
+                                    const ProductionActions *actions,
+                                    size_t numOfActions);
+
+/* Sets the hook run on every matched terminal, or removes it if it is `NULL`. Parses of token
+records pass it the record of the caller, so the leaves it builds can keep the offset and length
+of the lexeme rather than a copy of it. Other parses pass a record with the terminal and an empty
+lexeme at offset 0. It must be set before the parser is shared */
+void Parser__setTokenAction(Parser *self, TokenActionCallback runTokenAction);
+
+/* Creates a parser from a predictive parsing table saved by `Parser__saveTable`, mapping the
+file instead of computing the table again. `productions` must be the grammar the table was saved
+for, and `k` is read from the file */
+Parser *Parser__newFromTable(ProductionsHashMap *productions,
+                             RunRuleActionCallback runRuleAction,
+                             const char *tablePath);
+
+/* Saves the predictive parsing table into the file at `tablePath`, to be loaded with
+`Parser__newFromTable` */
+int8_t Parser__saveTable(const Parser *self, const char *tablePath);
+
+/* The `Parser__parse` functions, and the push parses started by `Parser__begin`, run through
+a context of their own and add its counters into the ones of the parser atomically, so they can
+be called from several threads at once as well */
 TreeNode *Parser__parse(Parser *self, TokenQueue *input);
+
+/* Parses the tokens pulled from `source` as the parser needs them, so only a small window of
+the input is kept in memory. The input ends when `source` returns no tokens */
+TreeNode *Parser__parseSource(Parser *self, TokenSource *source);
+
+/* Starts a parse whose input is pushed with `Parser__feed`, with one chunk at a time, in a new
+context */
+ParseContext *Parser__begin(Parser *self);
+
+/* Parses as much of the input as the tokens received so far allow and suspends until the next
+chunk. `tokens` is not referenced after the call returns. Once it fails, every call fails */
+int8_t Parser__feed(ParseContext *context,
+                    const CCB_terminal_t *tokens,
+                    size_t numOfTokens);
+
+/* Marks the end of the input, finishes the parse, and frees `context`, which must come from
+`Parser__begin`. Returns the tree, or `NULL` if the parse failed */
+TreeNode *Parser__finish(ParseContext *context);
+
+/* Parses the `numOfTokens` tokens of `tokens`, reading the lookahead directly from the array
+instead of a `TokenQueue`. `tokens` is never copied or modified, and it is read as if it was
+followed by end of texts */
+TreeNode *Parser__parseSpan(Parser *self,
+                            const CCB_terminal_t *tokens,
+                            size_t numOfTokens);
+
+/* Parses the terminals of the `numOfRecords` records of `records`, followed by end of texts.
+The records stay with the caller: the token action receives them, and the token positions of
+the listener and the syntax tree index them. Their 32-bit offsets limit the lexemes to the first
+4 GiB of the source buffer, as `TokenRecord` describes */
+TreeNode *Parser__parseRecords(Parser *self, const TokenRecord *records, size_t numOfRecords);
+
+/* Creates a context for the parses of `parser`, which must outlive it */
+ParseContext *ParseContext__new(const Parser *parser);
+
+/* Makes the next parses of the context pass `arena` to an arena rule action, or no arena if it
+is `NULL`. Their trees live in the arena, so they are released by resetting or deleting it
+rather than with `TreeNode__del`, even when the parse fails. A push parse in progress is
+abandoned */
+void ParseContext__setArena(ParseContext *self, ParseArena *arena);
+
+/* Makes the next parses of the context pass `context` to the production actions of the parser,
+which is `NULL` until it is set */
+void ParseContext__setActionContext(ParseContext *self, void *context);
+
+/* Makes the next parses of the context send their events to `listener`, which must outlive
+them, or stops sending events if it is `NULL`. The rule action still runs, so a parser without
+one streams the events without building any tree, and `ParseContext__getStatus` tells whether
+the parse succeeded. A push parse in progress is abandoned */
+void ParseContext__setListener(ParseContext *self, const ParseListener *listener);
+
+/* Makes the next parses of the context fill `syntaxTree`, emptied at the start of each, with a
+node for every production they expand and every terminal they match, or stop filling it if it
+is `NULL`. As with the listener, the rule action still runs, and a parser without one builds no
+other tree. After a failed parse the tree holds the nodes reached so far. A push parse in
+progress is abandoned */
+void ParseContext__setSyntaxTree(ParseContext *self, ConcreteSyntaxTree *syntaxTree);
+
+/* `CCB_SUCCESS` if the last parse of the context succeeded, `CCB_ERROR` if it failed or none
+ended yet */
+int8_t ParseContext__getStatus(const ParseContext *self);
+
+/* Same as the `Parser__parse` functions, reading the parser only */
+TreeNode *ParseContext__parse(ParseContext *self, TokenQueue *input);
+TreeNode *ParseContext__parseSource(ParseContext *self, TokenSource *source);
+TreeNode *ParseContext__parseSpan(ParseContext *self,
+                                  const CCB_terminal_t *tokens,
+                                  size_t numOfTokens);
+TreeNode *ParseContext__parseRecords(ParseContext *self,
+                                     const TokenRecord *records,
+                                     size_t numOfRecords);
+
+/* Starts a parse whose input is pushed with `Parser__feed`, abandoning the unfinished one of the
+context if any */
+void ParseContext__begin(ParseContext *self);
+
+/* Marks the end of the input and finishes the parse, keeping the context for the next one.
+Returns the tree, or `NULL` if the parse failed */
+TreeNode *ParseContext__finish(ParseContext *self);
+
+/* Counters of the parses of the context, as with `Parser__getStats` */
+int8_t ParseContext__getStats(const ParseContext *self, ParserStats *stats);
+
+void ParseContext__resetStats(ParseContext *self);
+
+void ParseContext__del(ParseContext *self);
+
+/* One input of `Parser__parseBatch`, read in place as with `Parser__parseSpan` */
+typedef struct TokenSpan
+{
+    const CCB_terminal_t *tokens;
+    size_t numOfTokens;
+} TokenSpan;
+
+/* Parses the `numOfInputs` independent inputs of `inputs` in `numOfThreads` threads, or in one
+per online processor if it is 0, and stores the tree of `inputs[i]` into `results[i]`, or `NULL`
+if its parse failed. The threads claim the inputs a few at a time and parse them with a context
+each, so the rule action must be safe to call from several threads at once. Returns `CCB_ERROR`
+if any input failed to parse.
+
+With a `NULL` `arenas`, the trees belong to the caller, who frees each with `TreeNode__del`.
+Otherwise `arenas` holds one arena per thread, so `numOfThreads` must not be 0, and each thread
+passes its own to an arena rule action as `ParseContext__setArena` does. The trees then live in
+the arena of the thread that parsed them, and are all released by resetting or deleting the
+arenas after the batch, which nothing else may use while it runs */
+int8_t Parser__parseBatch(Parser *self,
+                          const TokenSpan *inputs,
+                          size_t numOfInputs,
+                          TreeNode **results,
+                          ParseArena *const *arenas,
+                          unsigned numOfThreads);
+
+/* Copies the counters gathered since the parser was created, or since the last
+`Parser__resetStats`, into `stats`. Fails if the library was built without `CCB_ENABLE_STATS` */
+int8_t Parser__getStats(const Parser *self, ParserStats *stats);
+
+void Parser__resetStats(Parser *self);
+
 void Parser__del(Parser *self);
 
 #endif
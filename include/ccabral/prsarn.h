@@ -0,0 +1,35 @@
+#ifndef CCABRAL_PARSEARENA_H
+#define CCABRAL_PARSEARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <cbarroso/tree.h>
+
+/* Bump-pointer allocator for the trees built by the rule actions. Nodes are carved out of large
+blocks, so building a tree makes one allocation per block instead of several per node, and the
+whole tree is released at once by resetting or deleting the arena. Nodes of an arena must never
+be passed to `TreeNode__del` */
+typedef struct ParseArena ParseArena;
+
+/* Creates an arena whose first block holds `blockSize` bytes, or a default size if it is 0 */
+ParseArena *ParseArena__new(size_t blockSize);
+
+/* Returns `size` bytes aligned for any type, valid until the arena is reset or deleted */
+void *ParseArena__alloc(ParseArena *self, size_t size);
+
+/* Same as `TreeNode__new` and `TreeNode__insert`, with the node, its copy of `value` and the
+child link allocated from the arena. With a `NULL` arena they fall back to `TreeNode__new` and
+`TreeNode__insert`, so one rule action serves parses with and without an arena */
+TreeNode *ParseArena__newTreeNode(ParseArena *self, void *value, size_t valueSize);
+
+int8_t ParseArena__insertTreeNode(ParseArena *self, TreeNode *parent, TreeNode *child);
+
+/* Releases everything allocated from the arena, keeping its blocks for the next trees */
+void ParseArena__reset(ParseArena *self);
+
+/* Number of bytes allocated from the arena since it was created or last reset */
+size_t ParseArena__getNumOfBytes(const ParseArena *self);
+
+void ParseArena__del(ParseArena *self);
+
+#endif
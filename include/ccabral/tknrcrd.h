@@ -0,0 +1,23 @@
+#ifndef CCABRAL_TOKENRECORD_H
+#define CCABRAL_TOKENRECORD_H
+
+#include <stdint.h>
+#include "types.h"
+
+/* Token of a lexed input along with the place of its lexeme in the source buffer of the caller,
+so actions and trees can refer to the lexeme instead of copying it. The buffer is never read by
+the parser.
+
+The offset and length are 32 bits wide to keep records small, so every lexeme must end within
+the first 4 GiB of its buffer, with `offset + length` at most `UINT32_MAX`. Larger sources must be
+lexed into inputs of their own, each with offsets from its start */
+typedef struct TokenRecord
+{
+    CCB_terminal_t terminal;
+
+    /* Position of the first byte of the lexeme in the source buffer, and its number of bytes */
+    uint32_t offset;
+    uint32_t length;
+} TokenRecord;
+
+#endif
@@ -1,12 +1,43 @@
 #ifndef CCABRAL_TOKENQUEUE_H
 #define CCABRAL_TOKENQUEUE_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include "types.h"
-#include <cbarroso/queue.h>
 
-typedef Queue TokenQueue;
+/* FIFO of tokens backed by a ring buffer whose capacity is always a power of two, so wrapping
+around is a mask instead of a division */
+typedef struct TokenQueue
+{
+    CCB_terminal_t *tokens;
+    size_t capacity;
+
+    /* Index of the oldest token in `tokens` */
+    size_t head;
+
+    size_t numberOfTokens;
+} TokenQueue;
+
+TokenQueue *TokenQueue__new();
+
+/* Makes room for at least `numOfTokens` more tokens */
+int8_t TokenQueue__reserve(TokenQueue *self, size_t numOfTokens);
 
 int8_t TokenQueue__enqueue(TokenQueue *self, CCB_terminal_t newValue);
+
+/* Enqueues the `numOfTokens` tokens of `tokens` in order. Nothing is enqueued if any of them
+is not a valid token */
+int8_t TokenQueue__enqueueMany(TokenQueue *self,
+                               const CCB_terminal_t *tokens,
+                               size_t numOfTokens);
+
 int8_t TokenQueue__dequeue(TokenQueue *self, CCB_terminal_t *valueAddress);
 
+/* Dequeues up to `maxNumOfTokens` tokens into `buffer` and returns how many were dequeued */
+size_t TokenQueue__dequeueMany(TokenQueue *self,
+                               CCB_terminal_t *buffer,
+                               size_t maxNumOfTokens);
+
+void TokenQueue__del(TokenQueue *self);
+
 #endif
@@ -0,0 +1,19 @@
+#ifndef CCABRAL_TOKENSOURCE_H
+#define CCABRAL_TOKENSOURCE_H
+
+#include <stddef.h>
+#include "types.h"
+
+/* Writes up to `capacity` tokens into `buffer` and returns how many were written. Returning 0
+means the input has ended, and the callback is not called again */
+typedef size_t (*TokenSourceCallback)(void *context, CCB_terminal_t *buffer, size_t capacity);
+
+/* Input the parser pulls tokens from on demand, so a lexer can produce them while the
+parser consumes them */
+typedef struct TokenSource
+{
+    TokenSourceCallback read;
+    void *context;
+} TokenSource;
+
+#endif
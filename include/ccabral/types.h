@@ -3,10 +3,79 @@
 
 #include <stdint.h>
 
-typedef uint8_t CCB_grammar_t;
-typedef uint8_t CCB_grammartype_t;
-typedef uint8_t CCB_nonterminal_t;
+/* Widths, in bits, of the terminal, nonterminal and production ids. Each one can be forced to 8,
+16 or 32 with `CCB_TERMINAL_BITS`, `CCB_NONTERMINAL_BITS` and `CCB_PRODUCTION_BITS`. Otherwise
+the narrowest width that fits `CCB_NUM_OF_TERMINALS`, `CCB_NUM_OF_NONTERMINALS` and
+`CCB_NUM_OF_PRODUCTIONS` is picked, so the stack, tables and token buffers of small grammars stay
+small */
+#ifndef CCB_TERMINAL_BITS
+#if defined(CCB_NUM_OF_TERMINALS) && CCB_NUM_OF_TERMINALS > 65536
+#define CCB_TERMINAL_BITS 32
+#elif defined(CCB_NUM_OF_TERMINALS) && CCB_NUM_OF_TERMINALS > 256
+#define CCB_TERMINAL_BITS 16
+#else
+#define CCB_TERMINAL_BITS 8
+#endif
+#endif
+
+#ifndef CCB_NONTERMINAL_BITS
+#if defined(CCB_NUM_OF_NONTERMINALS) && CCB_NUM_OF_NONTERMINALS > 65536
+#define CCB_NONTERMINAL_BITS 32
+#elif defined(CCB_NUM_OF_NONTERMINALS) && CCB_NUM_OF_NONTERMINALS > 256
+#define CCB_NONTERMINAL_BITS 16
+#else
+#define CCB_NONTERMINAL_BITS 8
+#endif
+#endif
+
+/* Productions are signed, since `CCB_ERROR_PR` is -1 */
+#ifndef CCB_PRODUCTION_BITS
+#if defined(CCB_NUM_OF_PRODUCTIONS) && CCB_NUM_OF_PRODUCTIONS > 32768
+#define CCB_PRODUCTION_BITS 32
+#elif defined(CCB_NUM_OF_PRODUCTIONS) && CCB_NUM_OF_PRODUCTIONS > 128
+#define CCB_PRODUCTION_BITS 16
+#else
+#define CCB_PRODUCTION_BITS 8
+#endif
+#endif
+
+#if CCB_TERMINAL_BITS == 8
 typedef uint8_t CCB_terminal_t;
+#elif CCB_TERMINAL_BITS == 16
+typedef uint16_t CCB_terminal_t;
+#elif CCB_TERMINAL_BITS == 32
+typedef uint32_t CCB_terminal_t;
+#else
+#error "CCB_TERMINAL_BITS must be 8, 16 or 32"
+#endif
+
+#if CCB_NONTERMINAL_BITS == 8
+typedef uint8_t CCB_nonterminal_t;
+#elif CCB_NONTERMINAL_BITS == 16
+typedef uint16_t CCB_nonterminal_t;
+#elif CCB_NONTERMINAL_BITS == 32
+typedef uint32_t CCB_nonterminal_t;
+#else
+#error "CCB_NONTERMINAL_BITS must be 8, 16 or 32"
+#endif
+
+#if CCB_PRODUCTION_BITS == 8
 typedef int8_t CCB_production_t;
+#elif CCB_PRODUCTION_BITS == 16
+typedef int16_t CCB_production_t;
+#elif CCB_PRODUCTION_BITS == 32
+typedef int32_t CCB_production_t;
+#else
+#error "CCB_PRODUCTION_BITS must be 8, 16 or 32"
+#endif
+
+/* A grammar holds either a terminal or a nonterminal, so it is as wide as the widest of them */
+#if CCB_TERMINAL_BITS >= CCB_NONTERMINAL_BITS
+typedef CCB_terminal_t CCB_grammar_t;
+#else
+typedef CCB_nonterminal_t CCB_grammar_t;
+#endif
+
+typedef uint8_t CCB_grammartype_t;
 
 #endif
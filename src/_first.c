@@ -4,59 +4,51 @@
 #include <string.h>
 #include <cbarroso/hashmap.h>
 #include <cbarroso/sngllnkdlist.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
 #include <ccabral/_frstfllw.h>
 #include <ccabral/_grmmdata.h>
+#include <ccabral/_lggr.h>
 #include <ccabral/_prdcdata.h>
 #include <ccabral/_prdsmap.h>
 #include <ccabral/constants.h>
 
-static int8_t sInsertNewTerminalFromCurrGrammar(
-    DoublyLinkedListNode *currRightHandNode,
-    CCB_terminal_t *kSeq,
-    size_t *kSeqSizePtr,
-    ProductionsHashMap *productions,
-    DoublyLinkedListNode **nextNodePtr)
+static int8_t sFirst__allocateEntries(FirstFollow *self, FirstFollowWorklist *worklist)
 {
-    GrammarData *currGrammar = currRightHandNode->value;
-
-    if (currGrammar->type == CCB_TERMINAL_GT)
+    for (size_t prodIndex = 0; prodIndex < worklist->numOfProductions; prodIndex++)
     {
-        kSeq[*kSeqSizePtr] = currGrammar->id;
-        (*kSeqSizePtr)++;
-        *nextNodePtr = currRightHandNode->next;
-    }
+        CCB_nonterminal_t nonterminal = worklist->productions[prodIndex]->leftHand;
 
-    if (currGrammar->type == CCB_NONTERMINAL_GT)
-    {
-        ProductionsHashMapEntry *productionEntry;
+        if (self->entries[nonterminal] != NULL)
+        {
+            continue;
+        }
+
+        self->entries[nonterminal] = FirstFollowEntry__new(self->numOfTerminals);
 
-        if (HashMap__getItem(
-                productions,
-                &(currGrammar->id),
-                sizeof(CCB_nonterminal_t),
-                (void **)&productionEntry) <= CBR_ERROR)
+        if (self->entries[nonterminal] == NULL)
         {
-            fprintf(
-                stderr,
-                "Failed to get production for nonterminal NT%d",
-                currGrammar->id);
             return CCB_ERROR;
         }
+    }
+
+    for (size_t prodIndex = 0; prodIndex < worklist->numOfProductions; prodIndex++)
+    {
+        ProductionData *prodData = worklist->productions[prodIndex];
 
         for (
-            DoublyLinkedListNode *currSubProductionEntry = productionEntry->head;
-            currSubProductionEntry != NULL;
-            currSubProductionEntry = currSubProductionEntry->next)
+            DoublyLinkedListNode *currGrammarNode = prodData->rightHandHead;
+            currGrammarNode != NULL;
+            currGrammarNode = currGrammarNode->next)
         {
-            ProductionData *currSubProduction = (ProductionData *)currSubProductionEntry->value;
-            GrammarData *currSubProdFirstGrammar = currSubProduction->rightHandHead->value;
+            GrammarData *currGrammar = currGrammarNode->value;
 
-            if (!GrammarData__isEmptyString(currSubProdFirstGrammar))
+            if (currGrammar->type == CCB_NONTERMINAL_GT && self->entries[currGrammar->id] == NULL)
             {
-                *nextNodePtr = currSubProduction->rightHandHead;
-                break;
+                fprintf(
+                    stderr,
+                    "P%ld uses NT%lu, which has no production\n",
+                    (long)prodData->id,
+                    (unsigned long)currGrammar->id);
+                return CCB_ERROR;
             }
         }
     }
@@ -64,141 +56,75 @@ static int8_t sInsertNewTerminalFromCurrGrammar(
     return CCB_SUCCESS;
 }
 
-static int8_t sInsertTerminalsFromProd(
-    ProductionsHashMap *productions,
-    FirstFollowEntry *entry,
-    ProductionData *currProduction,
-    uint8_t k)
+static int8_t sFirst__populate(FirstFollow *self, FirstFollowWorklist *worklist, uint8_t k)
 {
-    size_t kSeqSize = 0;
-    CCB_terminal_t kSeq[k];
-
-    memset(kSeq, 0x0, k * sizeof(CCB_terminal_t));
+    ProductionData *prodData;
 
-    DoublyLinkedListNode *currRightHandNode = currProduction->rightHandHead;
-    
-    while (currRightHandNode != NULL && kSeqSize < k)
+    while (FirstFollowWorklist__pop(worklist, &prodData))
     {
-        DoublyLinkedListNode *nextNode = NULL;
-        
-        if (sInsertNewTerminalFromCurrGrammar(
-                currRightHandNode,
-                kSeq,
-                &kSeqSize,
-                productions,
-                &nextNode) <= CCB_ERROR)
+        bool wasChanged = false;
+
+        if (FirstFollowEntry__insertDerivations(
+                self->entries[prodData->leftHand],
+                prodData->rightHandHead,
+                self,
+                NULL,
+                k,
+                &wasChanged) <= CCB_ERROR)
         {
-            GrammarData *currGrammar = currRightHandNode->value;
             fprintf(
                 stderr,
-                "Failed to process grammar {id=%d, type=%d}\n",
-                currGrammar->id,
-                currGrammar->type);
-
+                "Failed to insert the derivations of P%ld\n",
+                (long)prodData->id);
             return CCB_ERROR;
         }
 
-        currRightHandNode = nextNode;
-    }
-
-    if (FirstFollowEntry__insert(
-            entry,
-            kSeq,
-            kSeqSize * sizeof(CCB_terminal_t)) <= CCB_ERROR)
-    {
-        fprintf(stderr, "Failed to insert terminals into first/follow entry\n");
-        return CCB_ERROR;
-    }
-
-    return CCB_SUCCESS;
-}
-
-static int8_t sFirst__insertTerminalsFromNonterminal(
-    FirstFollow *self,
-    ProductionsHashMap *productions,
-    HashMapEntry *currMapEntry,
-    uint8_t k)
-{
-    ProductionsHashMap *productionsCopy = ProductionsHashMap__deepCopy(productions);
-
-    if (productionsCopy == NULL)
-    {
-        fprintf(stderr, "Failed to copy productions\n");
-        return CCB_ERROR;
-    }
-
-    CCB_nonterminal_t nonterminal = *(CCB_nonterminal_t *)(currMapEntry->key);
-
-    self[nonterminal] = FirstFollowEntry__new();
-
-    if (self[nonterminal] == NULL)
-    {
-        return CCB_ERROR;
-    }
-
-    DoublyLinkedListNode *currNode = ((ProductionsHashMapEntry *)currMapEntry //
-                                          ->value)
-                                         ->head;
-
-    for (; currNode != NULL; currNode = currNode->next)
-    {
-        if (sInsertTerminalsFromProd(
-                productionsCopy,
-                self[nonterminal],
-                currNode->value,
-                k) <= CCB_ERROR)
+        if (wasChanged)
         {
-            return CCB_ERROR;
+            FirstFollowWorklist__pushDependents(worklist, prodData->leftHand);
         }
     }
 
-    ProductionsHashMap__del(productionsCopy);
-
     return CCB_SUCCESS;
 }
 
-FirstFollow *First__new(ProductionsHashMap *productions, uint8_t k)
+FirstFollow *First__new(
+    ProductionsHashMap *productions,
+    size_t numOfNonterminals,
+    size_t numOfTerminals,
+    uint8_t k)
 {
-    CCB_nonterminal_t visited[CCB_NUM_OF_NONTERMINALS];
-    FirstFollow *first = calloc(sizeof(FirstFollowEntry *), CCB_NUM_OF_NONTERMINALS);
+    /* Only the sets of `k == 1` hold terminals, the longer sequences go to the lists */
+    FirstFollow *first = FirstFollow__new(numOfNonterminals, k == 1 ? numOfTerminals : 0);
 
     if (first == NULL)
     {
-        fprintf(stderr, "Failed to allocate memory for first/follow table\n");
         return NULL;
     }
 
-    HashMapEntry **productionEntries = HashMap__getEntries(productions);
+    FirstFollowWorklist *worklist = FirstFollowWorklist__new(
+        productions,
+        numOfNonterminals,
+        true);
 
-    for (
-        uint8_t productionEntriesIdx = 0;
-        productionEntriesIdx < productions->nentries;
-        productionEntriesIdx++)
+    if (worklist == NULL)
     {
-        if (sFirst__insertTerminalsFromNonterminal(
-                first,
-                productions,
-                productionEntries[productionEntriesIdx],
-                k) <= CCB_ERROR)
-        {
-            fprintf(stderr, "Failed to process production\n");
-            FirstFollow__del(first);
-            return NULL;
-        }
+        FirstFollow__del(first);
+        return NULL;
     }
 
-    ClnLogger *logger = ClnLogger__new("_first.c", 11);
-
-    if (logger == NULL)
+    if (sFirst__allocateEntries(first, worklist) <= CCB_ERROR ||
+        sFirst__populate(first, worklist, k) <= CCB_ERROR)
     {
-        fprintf(
-            stderr,
-            "Failed to create logger '_first.c'");
-
+        fprintf(stderr, "Failed to process production\n");
+        FirstFollowWorklist__del(worklist);
         FirstFollow__del(first);
         return NULL;
     }
 
+    FirstFollowWorklist__del(worklist);
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
     char *firstStr = FirstFollow__str(first, k);
 
     if (firstStr == NULL)
@@ -206,19 +132,17 @@ FirstFollow *First__new(ProductionsHashMap *productions, uint8_t k)
         fprintf(stderr, "Failed to strigify FIRST table");
 
         FirstFollow__del(first);
-        ClnLogger__del(logger);
         return NULL;
     }
 
-    ClnLogger__log(
-        logger,
-        CLN_DEBUG_LL,
+    CCB_LOG_DEBUG(
+        CCB_FIRST_LM,
         "FIRST:\n%s",
-        9 + sizeof(firstStr),
+        9 + strlen(firstStr),
         firstStr);
 
     free(firstStr);
-    ClnLogger__del(logger);
+#endif
 
     return first;
 }
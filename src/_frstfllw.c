@@ -1,26 +1,51 @@
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
+#include <cbarroso/hashmap.h>
 #include <ccabral/_frstfllw.h>
+#include <ccabral/_prdcdata.h>
+#include <ccabral/_prdsmap.h>
+
+FirstFollow *FirstFollow__new(size_t numOfNonterminals, size_t numOfTerminals)
+{
+    FirstFollow *self = calloc(
+        1,
+        sizeof(FirstFollow) + numOfNonterminals * sizeof(FirstFollowEntry *));
+
+    if (self == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for first/follow table\n");
+        return NULL;
+    }
+
+    self->numOfNonterminals = numOfNonterminals;
+    self->numOfTerminals = numOfTerminals;
+
+    return self;
+}
 
 void FirstFollow__del(FirstFollow *self)
 {
-    FirstFollowEntry **entries = self;
-    for (size_t i = 0; i < CCB_NUM_OF_NONTERMINALS; i++)
+    for (size_t i = 0; i < self->numOfNonterminals; i++)
     {
-        if (entries[i] != NULL)
+        if (self->entries[i] != NULL)
         {
-            SinglyLinkedListNode__del(entries[i]->entriesHead);
-            free(entries[i]);
-            entries[i] = NULL;
+            FirstFollowEntry__del(self->entries[i]);
+            self->entries[i] = NULL;
         }
     }
 
     free(self);
 }
 
-FirstFollowEntry *FirstFollowEntry__new()
+FirstFollowEntry *FirstFollowEntry__new(size_t numOfTerminals)
 {
-    FirstFollowEntry *newEntry = calloc(1, sizeof(FirstFollowEntry));
+    size_t numOfWords = TerminalSet__numOfWords(numOfTerminals);
+
+    /* The words follow the entry in the same allocation */
+    FirstFollowEntry *newEntry = calloc(
+        1,
+        sizeof(FirstFollowEntry) + numOfWords * sizeof(uint64_t));
 
     if (newEntry == NULL)
     {
@@ -28,9 +53,18 @@ FirstFollowEntry *FirstFollowEntry__new()
         return NULL;
     }
 
+    newEntry->terminals.words = numOfWords == 0 ? NULL : (uint64_t *)(newEntry + 1);
+    newEntry->terminals.numOfTerminals = numOfTerminals;
+
     return newEntry;
 }
 
+void FirstFollowEntry__del(FirstFollowEntry *self)
+{
+    SinglyLinkedListNode__del(self->entriesHead);
+    free(self);
+}
+
 static int8_t sFirstFollowEntry__initialize(
     FirstFollowEntry *self,
     CCB_terminal_t *firstKTerminals,
@@ -92,14 +126,460 @@ int8_t FirstFollowEntry__insert(
         return CCB_SUCCESS;
     }
 
-    SinglyLinkedListNode__insertAtTail(
-        self->entriesTail,
-        kTerminals,
-        sizeOfKTerminals);
+    if (SinglyLinkedListNode__insertAtTail(
+            self->entriesTail,
+            kTerminals,
+            sizeOfKTerminals) <= CBR_ERROR)
+    {
+        fprintf(stderr, "Failed to insert into first/follow entry\n");
+        return CCB_ERROR;
+    }
+
+    self->entriesTail = self->entriesTail->next;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sFirstFollowEntry__insertNew(
+    FirstFollowEntry *self,
+    CCB_terminal_t *kSeq,
+    uint8_t k,
+    bool *wasChangedPtr)
+{
+    if (sFirstFollowEntry__containsSequence(self, kSeq, k * sizeof(CCB_terminal_t)))
+    {
+        return CCB_SUCCESS;
+    }
+
+    *wasChangedPtr = true;
+
+    return FirstFollowEntry__insert(self, kSeq, k * sizeof(CCB_terminal_t));
+}
+
+/* Whether nothing can be appended to the `kSeqLen` terminals of `kSeq`, because there are
+already `k` or the text ended */
+static inline bool sIsKSeqComplete(const CCB_terminal_t *kSeq, uint8_t kSeqLen, uint8_t k)
+{
+    return kSeqLen == k || (kSeqLen > 0 && kSeq[kSeqLen - 1] == CCB_END_OF_TEXT_TR);
+}
+
+/* Appends the terminals of `source` to the `*kSeqLenPtr` terminals of `kSeq`, up to `k` */
+static void sAppendKSeq(
+    CCB_terminal_t *kSeq,
+    uint8_t *kSeqLenPtr,
+    const CCB_terminal_t *source,
+    uint8_t k)
+{
+    for (uint8_t i = 0;
+         i < k && source[i] != CCB_EMPTY_STRING_TR && !sIsKSeqComplete(kSeq, *kSeqLenPtr, k);
+         i++)
+    {
+        kSeq[(*kSeqLenPtr)++] = source[i];
+    }
+}
+
+static int8_t sFirstFollowEntry__insertTails(
+    FirstFollowEntry *self,
+    const CCB_terminal_t *kSeq,
+    uint8_t kSeqLen,
+    FirstFollowEntry *tail,
+    uint8_t k,
+    bool *wasChangedPtr)
+{
+    CCB_terminal_t completedKSeq[k];
+
+    if (tail == NULL || sIsKSeqComplete(kSeq, kSeqLen, k))
+    {
+        memcpy(completedKSeq, kSeq, k * sizeof(CCB_terminal_t));
+        return sFirstFollowEntry__insertNew(self, completedKSeq, k, wasChangedPtr);
+    }
+
+    /* New sequences are appended to the end of `self`, so this also works when `tail` is
+    `self` */
+    for (SinglyLinkedListNode *curr = tail->entriesHead; curr != NULL; curr = curr->next)
+    {
+        uint8_t completedKSeqLen = kSeqLen;
+
+        memcpy(completedKSeq, kSeq, k * sizeof(CCB_terminal_t));
+        sAppendKSeq(completedKSeq, &completedKSeqLen, curr->value, k);
+
+        if (sFirstFollowEntry__insertNew(self, completedKSeq, k, wasChangedPtr) <= CCB_ERROR)
+        {
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sFirstFollowEntry__insertDerivationsFrom(
+    FirstFollowEntry *self,
+    DoublyLinkedListNode *grammarNode,
+    const CCB_terminal_t *kSeq,
+    uint8_t kSeqLen,
+    FirstFollow *first,
+    FirstFollowEntry *tail,
+    uint8_t k,
+    bool *wasChangedPtr)
+{
+    CCB_terminal_t prefix[k];
+    CCB_terminal_t nextKSeq[k];
+
+    memcpy(prefix, kSeq, k * sizeof(CCB_terminal_t));
+
+    /* Terminals only extend the sequence, so they are walked without recursing */
+    for (;
+         grammarNode != NULL && !sIsKSeqComplete(prefix, kSeqLen, k);
+         grammarNode = grammarNode->next)
+    {
+        GrammarData *grammar = grammarNode->value;
+
+        if (grammar->type == CCB_NONTERMINAL_GT)
+        {
+            break;
+        }
+
+        if (grammar->id != CCB_EMPTY_STRING_TR)
+        {
+            prefix[kSeqLen++] = grammar->id;
+        }
+    }
+
+    if (grammarNode == NULL || sIsKSeqComplete(prefix, kSeqLen, k))
+    {
+        return sFirstFollowEntry__insertTails(
+            self,
+            prefix,
+            kSeqLen,
+            tail,
+            k,
+            wasChangedPtr);
+    }
+
+    FirstFollowEntry *nonterminalEntry = first->entries[((GrammarData *)grammarNode->value)->id];
+
+    /* A nonterminal without sequences derives nothing yet */
+    if (nonterminalEntry == NULL)
+    {
+        return CCB_SUCCESS;
+    }
+
+    for (
+        SinglyLinkedListNode *curr = nonterminalEntry->entriesHead;
+        curr != NULL;
+        curr = curr->next)
+    {
+        uint8_t nextKSeqLen = kSeqLen;
+
+        memcpy(nextKSeq, prefix, k * sizeof(CCB_terminal_t));
+        sAppendKSeq(nextKSeq, &nextKSeqLen, curr->value, k);
+
+        if (sFirstFollowEntry__insertDerivationsFrom(
+                self,
+                grammarNode->next,
+                nextKSeq,
+                nextKSeqLen,
+                first,
+                tail,
+                k,
+                wasChangedPtr) <= CCB_ERROR)
+        {
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+/* Same as `sFirstFollowEntry__insertDerivationsFrom` on the terminal sets, where a derivation
+only goes on past the nonterminals deriving to the empty string */
+static void sFirstFollowEntry__insertLL1Derivations(
+    FirstFollowEntry *self,
+    DoublyLinkedListNode *grammarNode,
+    FirstFollow *first,
+    FirstFollowEntry *tail,
+    bool *wasChangedPtr)
+{
+    for (; grammarNode != NULL; grammarNode = grammarNode->next)
+    {
+        GrammarData *grammar = grammarNode->value;
+
+        if (grammar->type == CCB_TERMINAL_GT)
+        {
+            if (grammar->id == CCB_EMPTY_STRING_TR)
+            {
+                continue;
+            }
+
+            *wasChangedPtr |= TerminalSet__add(&self->terminals, grammar->id);
+            return;
+        }
+
+        FirstFollowEntry *nonterminalEntry = first->entries[grammar->id];
+
+        /* A nonterminal without sequences derives nothing yet */
+        if (nonterminalEntry == NULL)
+        {
+            return;
+        }
+
+        *wasChangedPtr |= TerminalSet__unionNonEmpty(
+            &self->terminals,
+            &nonterminalEntry->terminals);
+
+        if (!TerminalSet__contains(&nonterminalEntry->terminals, CCB_EMPTY_STRING_TR))
+        {
+            return;
+        }
+    }
+
+    if (tail == NULL)
+    {
+        *wasChangedPtr |= TerminalSet__add(&self->terminals, CCB_EMPTY_STRING_TR);
+    }
+    else
+    {
+        *wasChangedPtr |= TerminalSet__unionNonEmpty(&self->terminals, &tail->terminals);
+    }
+}
+
+int8_t FirstFollowEntry__insertDerivations(
+    FirstFollowEntry *self,
+    DoublyLinkedListNode *grammarNode,
+    FirstFollow *first,
+    FirstFollowEntry *tail,
+    uint8_t k,
+    bool *wasChangedPtr)
+{
+    if (k == 1)
+    {
+        sFirstFollowEntry__insertLL1Derivations(self, grammarNode, first, tail, wasChangedPtr);
+        return CCB_SUCCESS;
+    }
+
+    CCB_terminal_t kSeq[k];
+
+    memset(kSeq, CCB_EMPTY_STRING_TR, k * sizeof(CCB_terminal_t));
+
+    return sFirstFollowEntry__insertDerivationsFrom(
+        self,
+        grammarNode,
+        kSeq,
+        0,
+        first,
+        tail,
+        k,
+        wasChangedPtr);
+}
+
+/* Counts a dependent of `nonterminal` while `dependents` is not allocated, and places it
+afterwards */
+static void sFirstFollowWorklist__addDependent(
+    FirstFollowWorklist *self,
+    CCB_nonterminal_t nonterminal,
+    size_t productionIndex)
+{
+    if (self->dependents == NULL)
+    {
+        self->dependentOffsets[nonterminal + 1]++;
+    }
+    else
+    {
+        self->dependents[self->dependentOffsets[nonterminal]++] = productionIndex;
+    }
+}
+
+static void sFirstFollowWorklist__addDependents(
+    FirstFollowWorklist *self,
+    bool dependsOnRightHand)
+{
+    for (size_t productionIndex = 0; productionIndex < self->numOfProductions; productionIndex++)
+    {
+        ProductionData *prodData = self->productions[productionIndex];
+
+        if (!dependsOnRightHand)
+        {
+            sFirstFollowWorklist__addDependent(self, prodData->leftHand, productionIndex);
+            continue;
+        }
+
+        for (
+            DoublyLinkedListNode *currGrammarNode = prodData->rightHandHead;
+            currGrammarNode != NULL;
+            currGrammarNode = currGrammarNode->next)
+        {
+            GrammarData *currGrammar = currGrammarNode->value;
+
+            if (currGrammar->type == CCB_NONTERMINAL_GT)
+            {
+                sFirstFollowWorklist__addDependent(self, currGrammar->id, productionIndex);
+            }
+        }
+    }
+}
+
+static int8_t sFirstFollowWorklist__index(
+    FirstFollowWorklist *self,
+    ProductionsHashMap *productions,
+    bool dependsOnRightHand)
+{
+    HashMapEntry **entries = HashMap__getEntries(productions);
+    size_t productionIndex = 0;
+
+    for (ssize_t entryIndex = 0; entryIndex < productions->nentries; entryIndex++)
+    {
+        ProductionsHashMapEntry *prodMapEntry = entries[entryIndex]->value;
+
+        for (
+            DoublyLinkedListNode *currProdNode = prodMapEntry->head;
+            currProdNode != NULL;
+            currProdNode = currProdNode->next)
+        {
+            self->productions[productionIndex++] = currProdNode->value;
+        }
+    }
+
+    /* Counted first, then placed, so the dependents of each nonterminal are contiguous */
+    sFirstFollowWorklist__addDependents(self, dependsOnRightHand);
+
+    for (size_t nonterminal = 0; nonterminal < self->numOfNonterminals; nonterminal++)
+    {
+        self->dependentOffsets[nonterminal + 1] += self->dependentOffsets[nonterminal];
+    }
+
+    self->dependents = malloc(
+        (self->dependentOffsets[self->numOfNonterminals] + 1) * sizeof(size_t));
+
+    if (self->dependents == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for first/follow worklist\n");
+        return CCB_ERROR;
+    }
+
+    sFirstFollowWorklist__addDependents(self, dependsOnRightHand);
+
+    /* Placing moved each offset to the start of the next nonterminal */
+    memmove(
+        &self->dependentOffsets[1],
+        &self->dependentOffsets[0],
+        self->numOfNonterminals * sizeof(size_t));
+    self->dependentOffsets[0] = 0;
 
     return CCB_SUCCESS;
 }
 
+FirstFollowWorklist *FirstFollowWorklist__new(
+    ProductionsHashMap *productions,
+    size_t numOfNonterminals,
+    bool dependsOnRightHand)
+{
+    FirstFollowWorklist *self = calloc(1, sizeof(FirstFollowWorklist));
+
+    if (self == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for first/follow worklist\n");
+        return NULL;
+    }
+
+    self->numOfNonterminals = numOfNonterminals;
+
+    HashMapEntry **entries = HashMap__getEntries(productions);
+
+    for (ssize_t entryIndex = 0; entryIndex < productions->nentries; entryIndex++)
+    {
+        ProductionsHashMapEntry *prodMapEntry = entries[entryIndex]->value;
+
+        for (
+            DoublyLinkedListNode *currProdNode = prodMapEntry->head;
+            currProdNode != NULL;
+            currProdNode = currProdNode->next)
+        {
+            self->numOfProductions++;
+        }
+    }
+
+    self->productions = malloc((self->numOfProductions + 1) * sizeof(ProductionData *));
+    self->dependentOffsets = calloc(numOfNonterminals + 1, sizeof(size_t));
+    self->queue = malloc((self->numOfProductions + 1) * sizeof(size_t));
+    self->isQueued = malloc((self->numOfProductions + 1) * sizeof(bool));
+
+    if (self->productions == NULL ||
+        self->dependentOffsets == NULL ||
+        self->queue == NULL ||
+        self->isQueued == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for first/follow worklist\n");
+        FirstFollowWorklist__del(self);
+        return NULL;
+    }
+
+    if (sFirstFollowWorklist__index(self, productions, dependsOnRightHand) <= CCB_ERROR)
+    {
+        FirstFollowWorklist__del(self);
+        return NULL;
+    }
+
+    for (size_t productionIndex = 0; productionIndex < self->numOfProductions; productionIndex++)
+    {
+        self->queue[productionIndex] = productionIndex;
+        self->isQueued[productionIndex] = true;
+    }
+
+    self->queueSize = self->numOfProductions;
+
+    return self;
+}
+
+bool FirstFollowWorklist__pop(FirstFollowWorklist *self, ProductionData **productionPtr)
+{
+    if (self->queueSize == 0)
+    {
+        return false;
+    }
+
+    size_t productionIndex = self->queue[self->queueHead];
+
+    self->queueHead = (self->queueHead + 1) % self->numOfProductions;
+    self->queueSize--;
+    self->isQueued[productionIndex] = false;
+    *productionPtr = self->productions[productionIndex];
+
+    return true;
+}
+
+void FirstFollowWorklist__pushDependents(
+    FirstFollowWorklist *self,
+    CCB_nonterminal_t nonterminal)
+{
+    for (
+        size_t dependentIndex = self->dependentOffsets[nonterminal];
+        dependentIndex < self->dependentOffsets[nonterminal + 1];
+        dependentIndex++)
+    {
+        size_t productionIndex = self->dependents[dependentIndex];
+
+        if (self->isQueued[productionIndex])
+        {
+            continue;
+        }
+
+        self->queue[(self->queueHead + self->queueSize) % self->numOfProductions] =
+            productionIndex;
+        self->queueSize++;
+        self->isQueued[productionIndex] = true;
+    }
+}
+
+void FirstFollowWorklist__del(FirstFollowWorklist *self)
+{
+    free(self->productions);
+    free(self->dependentOffsets);
+    free(self->dependents);
+    free(self->queue);
+    free(self->isQueued);
+    free(self);
+}
+
 char *FirstFollowEntryNode__str(FirstFollowEntryNode *node, uint8_t k)
 {
     if (node == NULL)
@@ -107,8 +587,8 @@ char *FirstFollowEntryNode__str(FirstFollowEntryNode *node, uint8_t k)
         return NULL;
     }
 
-    // Calculate required buffer size: "(" + k terminals "T%u, " + ")"
-    size_t bufferSize = 2 + k * 10 + 1; // generous estimate
+    // Calculate required buffer size: "(" + k terminals "T%lu, " of up to 13 chars + ")"
+    size_t bufferSize = 2 + k * 13 + 1;
 
     char *result = calloc(bufferSize, 1);
     if (result == NULL)
@@ -145,7 +625,7 @@ char *FirstFollowEntryNode__str(FirstFollowEntryNode *node, uint8_t k)
             ptr += written;
             remaining -= written;
         }
-        written = snprintf(ptr, remaining, "T%u", terminals[j]);
+        written = snprintf(ptr, remaining, "T%lu", (unsigned long)terminals[j]);
         if (written < 0 || (size_t)written >= remaining)
         {
             free(result);
@@ -165,27 +645,54 @@ char *FirstFollowEntryNode__str(FirstFollowEntryNode *node, uint8_t k)
     return result;
 }
 
-char *FirstFollowEntry__str(FirstFollowEntry *self, uint8_t k)
+/* Returns the number of sequences in the entry, wherever they are kept for `k` */
+static size_t sFirstFollowEntry__count(FirstFollowEntry *self, uint8_t k)
 {
-    if (self == NULL || self->entriesHead == NULL)
+    size_t entryCount = 0;
+
+    if (k == 1)
     {
-        return NULL;
-    }
+        for (size_t terminal = TerminalSet__next(&self->terminals, 0);
+             terminal < self->terminals.numOfTerminals;
+             terminal = TerminalSet__next(&self->terminals, terminal + 1))
+        {
+            entryCount++;
+        }
 
-    // Calculate required buffer size
-    size_t bufferSize = 1; // for null terminator
-    bufferSize += 4;       // "{ } "
+        return entryCount;
+    }
 
-    size_t entryCount = 0;
     for (SinglyLinkedListNode *curr = self->entriesHead;
          curr != NULL;
          curr = curr->next)
     {
         entryCount++;
-        // "(" + k terminals "T%u, " + ")" + possible ", "
-        bufferSize += 2 + k * 10 + 2;
     }
 
+    return entryCount;
+}
+
+char *FirstFollowEntry__str(FirstFollowEntry *self, uint8_t k)
+{
+    if (self == NULL)
+    {
+        return NULL;
+    }
+
+    size_t entryCount = sFirstFollowEntry__count(self, k);
+
+    if (entryCount == 0)
+    {
+        return NULL;
+    }
+
+    // Calculate required buffer size
+    size_t bufferSize = 1; // for null terminator
+    bufferSize += 4;       // "{ } "
+
+    // "(" + k terminals "T%lu, " of up to 13 chars + ")" + possible ", "
+    bufferSize += entryCount * (2 + k * 13 + 2);
+
     char *result = calloc(bufferSize, 1);
     if (result == NULL)
     {
@@ -206,7 +713,23 @@ char *FirstFollowEntry__str(FirstFollowEntry *self, uint8_t k)
     remaining -= written;
 
     int isFirst = 1;
-    for (SinglyLinkedListNode *curr = self->entriesHead;
+
+    if (k == 1)
+    {
+        for (size_t terminal = TerminalSet__next(&self->terminals, 0);
+             terminal < self->terminals.numOfTerminals;
+             terminal = TerminalSet__next(&self->terminals, terminal + 1))
+        {
+            written = snprintf(ptr, remaining, "%s(T%zu)", isFirst ? "" : ", ", terminal);
+            if (written < 0 || (size_t)written >= remaining)
+                break;
+            ptr += written;
+            remaining -= written;
+            isFirst = 0;
+        }
+    }
+
+    for (SinglyLinkedListNode *curr = k == 1 ? NULL : self->entriesHead;
          curr != NULL;
          curr = curr->next)
     {
@@ -247,25 +770,21 @@ char *FirstFollow__str(FirstFollow *self, uint8_t k)
 {
     assert(self != NULL);
 
-    FirstFollowEntry **entries = self;
+    FirstFollowEntry **entries = self->entries;
 
     // Calculate required buffer size
     size_t bufferSize = 1; // for null terminator
-    for (size_t i = 0; i < CCB_NUM_OF_NONTERMINALS; i++)
+    for (size_t i = 0; i < self->numOfNonterminals; i++)
     {
-        if (entries[i] != NULL && entries[i]->entriesHead != NULL)
+        size_t entryCount = entries[i] == NULL ? 0 : sFirstFollowEntry__count(entries[i], k);
+
+        if (entryCount > 0)
         {
             // "NT%zu | " + entry string + "\n"
             bufferSize += 20;
 
-            // Count entries
-            for (SinglyLinkedListNode *curr = entries[i]->entriesHead;
-                 curr != NULL;
-                 curr = curr->next)
-            {
-                // "(" + k terminals "T%u, " + ")" + possible ", "
-                bufferSize += 2 + k * 10 + 2;
-            }
+            // "(" + k terminals "T%lu, " of up to 13 chars + ")" + possible ", "
+            bufferSize += entryCount * (2 + k * 13 + 2);
 
             // " { }\n"
             bufferSize += 5;
@@ -282,9 +801,9 @@ char *FirstFollow__str(FirstFollow *self, uint8_t k)
     char *ptr = result;
     size_t remaining = bufferSize;
 
-    for (size_t i = 0; i < CCB_NUM_OF_NONTERMINALS; i++)
+    for (size_t i = 0; i < self->numOfNonterminals; i++)
     {
-        if (entries[i] != NULL && entries[i]->entriesHead != NULL)
+        if (entries[i] != NULL)
         {
             char *entryStr = FirstFollowEntry__str(entries[i], k);
             if (entryStr == NULL)
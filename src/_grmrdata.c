@@ -4,42 +4,28 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
 #include <ccabral/_grmmdata.h>
+#include <ccabral/_lggr.h>
 #include <ccabral/constants.h>
 
 bool isGrammarValid(CCB_grammar_t grammarId, CCB_grammartype_t grammarType)
 {
-    const char *loggerName = "isGrammarValid";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
-
-    if (logger == NULL)
-    {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n", loggerName);
-
-        return false;
-    }
-
     if (grammarType == CCB_TERMINAL_GT && grammarId < CCB_NUM_OF_TERMINALS)
         return true;
 
     else if (grammarType == CCB_NONTERMINAL_GT && grammarId < CCB_NUM_OF_NONTERMINALS)
         return true;
 
-    ClnLogger__log(
-        logger,
-        CLN_CRITICAL_LL,
-        "GrammarData {id=%d, type=%d} is invalid\n\tCCB_NUM_OF_TERMINALS=%d\n\tCCB_NUM_OF_NONTERMINALS=%d",
+    CCB_LOG_CRITICAL(
+        CCB_GRAMMAR_LM,
+        "GrammarData {id=%lu, type=%d} is invalid\n\tCCB_NUM_OF_TERMINALS=%lu\n"
+        "\tCCB_NUM_OF_NONTERMINALS=%lu",
         128,
-        grammarId,
+        (unsigned long)grammarId,
         grammarType,
-        CCB_NUM_OF_TERMINALS,
-        CCB_NUM_OF_NONTERMINALS);
+        (unsigned long)CCB_NUM_OF_TERMINALS,
+        (unsigned long)CCB_NUM_OF_NONTERMINALS);
 
-    ClnLogger__del(logger);
     return false;
 }
 
@@ -61,21 +47,22 @@ char *GrammarData__str(GrammarData *self)
 {
     assert(self != NULL);
 
-    const size_t MAX_LENGTH = 6;
+    /* "NT" and the 10 digits of the largest 32-bit id */
+    const size_t MAX_LENGTH = sizeof("NT") + 10;
     char *grammarDataStr = calloc(MAX_LENGTH, sizeof(char));
 
     if (self->type == CCB_TERMINAL_GT)
         snprintf(
             grammarDataStr,
             MAX_LENGTH,
-            "T%d",
-            self->id);
+            "T%lu",
+            (unsigned long)self->id);
     else if (self->type == CCB_NONTERMINAL_GT)
         snprintf(
             grammarDataStr,
             MAX_LENGTH,
-            "NT%d",
-            self->id);
+            "NT%lu",
+            (unsigned long)self->id);
     else
         assert(false);
 
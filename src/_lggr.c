@@ -0,0 +1,54 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <clinschoten/logger.h>
+#include <ccabral/_lggr.h>
+
+static const char *const kLoggerNames[CCB_NUM_OF_LOG_MODULES] = {
+    [CCB_FIRST_LM] = "ccabral.first",
+    [CCB_FOLLOW_LM] = "ccabral.follow",
+    [CCB_GRAMMAR_LM] = "ccabral.grammar",
+    [CCB_PRDCPRSNTBLE_LM] = "ccabral.prdcprsntble",
+    [CCB_PRDSMAP_LM] = "ccabral.prdsmap",
+    [CCB_PARSER_LM] = "ccabral.parser",
+};
+
+static ClnLogger *sLoggers[CCB_NUM_OF_LOG_MODULES];
+static pthread_once_t sLoggersOnce = PTHREAD_ONCE_INIT;
+
+static void sDelLoggers(void)
+{
+    for (int module = 0; module < CCB_NUM_OF_LOG_MODULES; module++)
+    {
+        if (sLoggers[module] != NULL)
+        {
+            ClnLogger__del(sLoggers[module]);
+            sLoggers[module] = NULL;
+        }
+    }
+}
+
+static void sNewLoggers(void)
+{
+    for (int module = 0; module < CCB_NUM_OF_LOG_MODULES; module++)
+    {
+        const char *loggerName = kLoggerNames[module];
+        sLoggers[module] = ClnLogger__new(loggerName, strlen(loggerName));
+
+        if (sLoggers[module] == NULL)
+        {
+            fprintf(stderr, "Failed to create logger '%s'\n", loggerName);
+        }
+    }
+
+    atexit(sDelLoggers);
+}
+
+ClnLogger *CCB_getLogger(CCB_logmodule_t module)
+{
+    /* Parses running in several threads at once may log first at the same time */
+    pthread_once(&sLoggersOnce, sNewLoggers);
+
+    return sLoggers[module];
+}
@@ -6,31 +6,17 @@
 #include <ccabral/_grmmdata.h>
 #include <ccabral/prdcdata.h>
 #include <ccabral/constants.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
 
 ProductionData *ProductionData__deepCopy(ProductionData *self)
 {
-    const char *loggerName = "ProductionData__deepCopy";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
-
-    if (logger == NULL)
-    {
-        fprintf(
-            stderr,
-            "Failed to create logger 'ProductionData__deepCopy'");
-        return NULL;
-    }
-
     char *originProdDataStr = ProductionData__str(self);
 
     if (originProdDataStr == NULL)
     {
         fprintf(
             stderr,
-            "Failed to strigify `originProdDataStr` in `ProductionData__deepCopy` for P%d\n",
-            self->id);
-        ClnLogger__del(logger);
+            "Failed to strigify `originProdDataStr` in `ProductionData__deepCopy` for P%ld\n",
+            (long)self->id);
         return NULL;
     }
 
@@ -39,7 +25,6 @@ ProductionData *ProductionData__deepCopy(ProductionData *self)
     {
         fprintf(stderr, "Failed to allocate memory for ProductionData copy\n");
         free(originProdDataStr);
-        ClnLogger__del(logger);
         return NULL;
     }
 
@@ -78,7 +63,6 @@ ProductionData *ProductionData__deepCopy(ProductionData *self)
 
             free(grammarDataStr);
             free(originProdDataStr);
-            ClnLogger__del(logger);
             free(copy);
             return NULL;
         }
@@ -121,7 +105,6 @@ ProductionData *ProductionData__deepCopy(ProductionData *self)
                     free(grammarDataStr);
 
                 free(originProdDataStr);
-                ClnLogger__del(logger);
                 DoublyLinkedListNode__del(copy->rightHandHead);
                 free(copy);
                 return NULL;
@@ -133,7 +116,6 @@ ProductionData *ProductionData__deepCopy(ProductionData *self)
     }
 
     free(originProdDataStr);
-    ClnLogger__del(logger);
 
     return copy;
 }
@@ -1,14 +1,22 @@
-#include <assert.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <cbarroso/constants.h>
 #include <cbarroso/hashmap.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
+#include <ccabral/_chcksm.h>
 #include <ccabral/_frstfllw.h>
 #include <ccabral/_grmmdata.h>
+#include <ccabral/_lggr.h>
 #include <ccabral/_prdsmap.h>
 #include <ccabral/_prdcdata.h>
 #include <ccabral/_prdcprsntble.h>
@@ -48,92 +56,56 @@ static bool sProductionYieldsEpsilon(
     return false;
 }
 
-static bool sDoesProductionMatchesFirstEntry(
-    ProductionData *currProdData,
-    CCB_terminal_t *currFirstKSeq,
+int8_t PrdcPrsnTble__getItem(
+    PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    CCB_terminal_t *kSeq,
     uint8_t k,
-    ProductionsHashMap *productions,
-    FirstFollow *first)
+    CCB_production_t *production)
 {
-    assert(currFirstKSeq[0] != CCB_EMPTY_STRING_TR);
-
-    DoublyLinkedListNode *currNode = currProdData->rightHandHead;
-    uint8_t firstEntryIndex = 0;
+    if (self->k == 1)
+    {
+        *production = PrdcPrsnTble__getLL1Item(self, nonterminal, kSeq[0]);
+        return CCB_SUCCESS;
+    }
 
-    while (currNode != NULL //
-           && firstEntryIndex < k)
+    /* Loaded tables only have the trie */
+    if (self->kSeqMaps == NULL)
     {
-        if (currFirstKSeq[firstEntryIndex] == CCB_EMPTY_STRING_TR)
+        uint32_t nodeIndex = self->trieRoots[nonterminal];
+
+        while (k > 1 && kSeq[k - 1] == CCB_EMPTY_STRING_TR)
         {
-            return true;
+            k--;
         }
 
-        GrammarData *grammarData = (GrammarData *)currNode->value;
-
-        if (grammarData->type == CCB_TERMINAL_GT)
+        for (uint8_t depth = 0; depth < k && nodeIndex != 0; depth++)
         {
-            if (grammarData->id != currFirstKSeq[firstEntryIndex])
-            {
-                return false;
-            }
-            firstEntryIndex++;
-            currNode = currNode->next;
+            nodeIndex = PrdcPrsnTble__getTrieChild(self, nodeIndex, kSeq[depth]);
         }
-        else if (grammarData->type == CCB_NONTERMINAL_GT)
-        {
-            bool wasFound = false;
 
-            for (
-                FirstFollowEntryNode *currFirstEntry = //
-                first[grammarData->id]->entriesHead;
-                currFirstEntry != NULL;
-                currFirstEntry = currFirstEntry->next)
-            {
-                CCB_terminal_t *currFirstEntryValue = currFirstEntry->value;
-
-                if (currFirstEntryValue[0] == currFirstKSeq[firstEntryIndex])
-                {
-                    firstEntryIndex++;
-                    currNode = currNode->next;
-                    wasFound = true;
-                    break;
-                }
-            }
-
-            if (!wasFound)
-            {
-                return false;
-            }
-        }
-        else
-            assert(false);
+        *production = nodeIndex == 0 ? CCB_ERROR_PR : self->trieNodes[nodeIndex].production;
+        return CCB_SUCCESS;
     }
 
-    return true;
-}
-
-int8_t PrdcPrsnTble__getItem(
-    PrdcPrsnTble *self,
-    CCB_nonterminal_t nonterminal,
-    CCB_terminal_t *kSeq,
-    uint8_t k,
-    CCB_production_t *production)
-{
     CCB_production_t *prodPtr = NULL;
 
     if (HashMap__getItem(
-            (HashMap *)self[nonterminal],
+            self->kSeqMaps[nonterminal],
             kSeq,
             sizeof(CCB_terminal_t) * k,
             (void **)&prodPtr) <= CBR_ERROR)
     {
-        fprintf(stderr, "Failed to get rule for nonterminal NT%d\n", nonterminal);
+        fprintf(
+            stderr,
+            "Failed to get rule for nonterminal NT%lu\n",
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
 
     if (prodPtr == NULL)
     {
-        *production = (CCB_production_t)-1;
+        *production = CCB_ERROR_PR;
     }
     else
     {
@@ -150,22 +122,34 @@ int8_t PrdcPrsnTble__setItem(
     uint8_t k,
     CCB_production_t production)
 {
+    if (self->k == 1)
+    {
+        self->ll1Table[(size_t)nonterminal * self->numOfTerminals + kSeq[0]] = production;
+        return CCB_SUCCESS;
+    }
+
     CCB_production_t *prodPtr = malloc(sizeof(CCB_production_t));
     if (prodPtr == NULL)
     {
-        fprintf(stderr, "Failed to allocate production for nonterminal NT%d\n", nonterminal);
+        fprintf(
+            stderr,
+            "Failed to allocate production for nonterminal NT%lu\n",
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
     *prodPtr = production;
 
     if (HashMap__setItem(
-            (HashMap *)self[nonterminal],
+            self->kSeqMaps[nonterminal],
             kSeq,
             k * sizeof(CCB_terminal_t),
             prodPtr,
             sizeof(CCB_production_t)) <= CBR_ERROR)
     {
-        fprintf(stderr, "Failed to set rule for nonterminal NT%d\n", nonterminal);
+        fprintf(
+            stderr,
+            "Failed to set rule for nonterminal NT%lu\n",
+            (unsigned long)nonterminal);
         free(prodPtr);
         return CCB_ERROR;
     }
@@ -227,9 +211,9 @@ static int8_t sSetPrdc4NtNTrInPrdcPrsnTble(
         {
             fprintf(
                 stderr,
-                "A collision was found for rule P%d and nonterminal NT%d\n",
-                rule,
-                nonterminal);
+                "A collision was found for rule P%ld and nonterminal NT%lu\n",
+                (long)rule,
+                (unsigned long)nonterminal);
             return CCB_ERROR;
         }
     }
@@ -242,14 +226,87 @@ static int8_t sSetPrdc4NtNTrInPrdcPrsnTble(
     return CCB_SUCCESS;
 }
 
+/* Predicts `prodData` for every `k` terminals its right hand side derives to, completed with
+the FOLLOW of its left hand side */
+static int8_t sPopulatePrdtPrsnTableFromProduction(
+    PrdcPrsnTble *prdtPrsnTable,
+    ProductionData *prodData,
+    FirstFollow *first,
+    FirstFollow *follow,
+    ProductionsHashMap *productions,
+    uint8_t k)
+{
+    FirstFollowEntry *predictions = FirstFollowEntry__new(first->numOfTerminals);
+    bool wasChanged = false;
+
+    if (predictions == NULL)
+    {
+        return CCB_ERROR;
+    }
+
+    if (FirstFollowEntry__insertDerivations(
+            predictions,
+            prodData->rightHandHead,
+            first,
+            follow->entries[prodData->leftHand],
+            k,
+            &wasChanged) <= CCB_ERROR)
+    {
+        FirstFollowEntry__del(predictions);
+        return CCB_ERROR;
+    }
+
+    /* The terminal set is empty when `k > 1` */
+    for (size_t terminal = TerminalSet__next(&predictions->terminals, 0);
+         terminal < predictions->terminals.numOfTerminals;
+         terminal = TerminalSet__next(&predictions->terminals, terminal + 1))
+    {
+        CCB_terminal_t kSeq[1] = {(CCB_terminal_t)terminal};
+
+        if (sSetPrdc4NtNTrInPrdcPrsnTble(
+                prdtPrsnTable,
+                prodData->id,
+                prodData->leftHand,
+                kSeq,
+                productions,
+                k) <= CCB_ERROR)
+        {
+            FirstFollowEntry__del(predictions);
+            return CCB_ERROR;
+        }
+    }
+
+    for (
+        FirstFollowEntryNode *currPredictionNode = predictions->entriesHead;
+        currPredictionNode != NULL;
+        currPredictionNode = currPredictionNode->next)
+    {
+        if (sSetPrdc4NtNTrInPrdcPrsnTble(
+                prdtPrsnTable,
+                prodData->id,
+                prodData->leftHand,
+                currPredictionNode->value,
+                productions,
+                k) <= CCB_ERROR)
+        {
+            FirstFollowEntry__del(predictions);
+            return CCB_ERROR;
+        }
+    }
+
+    FirstFollowEntry__del(predictions);
+
+    return CCB_SUCCESS;
+}
+
 static int8_t sPopulatePrdtPrsnTable(
     PrdcPrsnTble *prdtPrsnTable,
-    FirstFollowEntry **first,
-    FirstFollowEntry **follow,
+    FirstFollow *first,
+    FirstFollow *follow,
     ProductionsHashMap *productions,
     uint8_t k)
 {
-    for (uint8_t prdcIndex = 0; prdcIndex < productions->nentries; prdcIndex++)
+    for (ssize_t prdcIndex = 0; prdcIndex < productions->nentries; prdcIndex++)
     {
         DoublyLinkedListNode *currNode = ((ProductionsHashMapEntry *)HashMap__getEntries(
                                               productions)[prdcIndex]
@@ -258,144 +315,343 @@ static int8_t sPopulatePrdtPrsnTable(
 
         for (; currNode != NULL; currNode = currNode->next)
         {
-            ProductionData *currProdData = currNode->value;
-            CCB_nonterminal_t productionNonterminal = currProdData->leftHand;
+            if (sPopulatePrdtPrsnTableFromProduction(
+                    prdtPrsnTable,
+                    currNode->value,
+                    first,
+                    follow,
+                    productions,
+                    k) <= CCB_ERROR)
+            {
+                return CCB_ERROR;
+            }
+        }
+    }
 
-            GrammarData *firstElement = (GrammarData *)currProdData->rightHandHead->value;
-            CCB_grammar_t firstTerminalOfProduction = firstElement->id;
+    return CCB_SUCCESS;
+}
 
-            if (firstTerminalOfProduction == CCB_EMPTY_STRING_TR)
-            {
-                FirstFollowEntry *followEntryForNonterminal = follow[productionNonterminal];
+/* Sizes the table for one past the highest nonterminal and terminal ids the productions use,
+with room for the end of text at least */
+static void sPrdcPrsnTble__measure(PrdcPrsnTble *self, ProductionsHashMap *productions)
+{
+    self->numOfNonterminals = 1;
+    self->numOfTerminals = CCB_END_OF_TEXT_TR + 1;
 
-                SinglyLinkedListNode *currFollowNode = followEntryForNonterminal->entriesHead;
-                for (; currFollowNode != NULL; currFollowNode = currFollowNode->next)
-                {
-                    CCB_terminal_t *currFollowKSeq = currFollowNode->value;
-
-                    if (sSetPrdc4NtNTrInPrdcPrsnTble(
-                            prdtPrsnTable,
-                            currProdData->id,
-                            productionNonterminal,
-                            currFollowKSeq,
-                            productions,
-                            k) <= CCB_ERROR)
-                    {
-                        return CCB_ERROR;
-                    }
-                }
+    for (ssize_t prdcIndex = 0; prdcIndex < productions->nentries; prdcIndex++)
+    {
+        DoublyLinkedListNode *currNode = ((ProductionsHashMapEntry *)HashMap__getEntries(
+                                              productions)[prdcIndex]
+                                              ->value)
+                                             ->head;
+
+        for (; currNode != NULL; currNode = currNode->next)
+        {
+            ProductionData *prodData = currNode->value;
+
+            if ((size_t)prodData->leftHand >= self->numOfNonterminals)
+            {
+                self->numOfNonterminals = (size_t)prodData->leftHand + 1;
             }
-            else
+
+            for (
+                DoublyLinkedListNode *grammarNode = prodData->rightHandHead;
+                grammarNode != NULL;
+                grammarNode = grammarNode->next)
             {
-                FirstFollowEntry *firstEntryForNonterminal = first[productionNonterminal];
-                uint8_t didProductionMatched = false;
-
-                for (
-                    FirstFollowEntryNode *currFirstNode = firstEntryForNonterminal //
-                                                              ->entriesHead;
-                    currFirstNode != NULL;
-                    currFirstNode = currFirstNode->next)
-                {
-                    CCB_terminal_t *currFirstKSeq = currFirstNode->value;
-
-                    if (sDoesProductionMatchesFirstEntry(
-                            currProdData,
-                            currFirstKSeq,
-                            k,
-                            productions,
-                            first))
-                    {
-                        if (sSetPrdc4NtNTrInPrdcPrsnTble(
-                                prdtPrsnTable,
-                                currProdData->id,
-                                productionNonterminal,
-                                currFirstKSeq,
-                                productions,
-                                k) <= CCB_ERROR)
-                        {
-                            return CCB_ERROR;
-                        }
-
-                        didProductionMatched = true;
-                        break;
-                    }
-                }
+                GrammarData *grammar = grammarNode->value;
+                size_t *countPtr = grammar->type == CCB_NONTERMINAL_GT
+                                       ? &self->numOfNonterminals
+                                       : &self->numOfTerminals;
 
-                if (!didProductionMatched)
+                if ((size_t)grammar->id >= *countPtr)
                 {
-                    fprintf(
-                        stderr,
-                        "No entry in FIRST matched production P%d\n",
-                        currProdData->id);
-                    return CCB_ERROR;
+                    *countPtr = (size_t)grammar->id + 1;
                 }
             }
         }
     }
+}
+
+/* Maps the whole file at `path` into read-only memory, or reads it into a heap buffer where
+`mmap` is not available */
+static int8_t sMapFile(const char *path, void **mappingPtr, size_t *mappingSizePtr)
+{
+#ifdef HAS_MMAP
+    int fileDescriptor = open(path, O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        fprintf(stderr, "Failed to open the predictive parsing table file %s\n", path);
+        return CCB_ERROR;
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        fprintf(stderr, "Failed to read the size of the predictive parsing table file %s\n", path);
+        close(fileDescriptor);
+        return CCB_ERROR;
+    }
+
+    void *mapping = mmap(
+        NULL,
+        (size_t)fileStat.st_size,
+        PROT_READ,
+        MAP_PRIVATE,
+        fileDescriptor,
+        0);
+    close(fileDescriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        fprintf(stderr, "Failed to map the predictive parsing table file %s\n", path);
+        return CCB_ERROR;
+    }
+
+    *mappingPtr = mapping;
+    *mappingSizePtr = (size_t)fileStat.st_size;
+
+    return CCB_SUCCESS;
+#else
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to open the predictive parsing table file %s\n", path);
+        return CCB_ERROR;
+    }
+
+    long fileSize = -1;
+
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        fileSize = ftell(file);
+    }
+
+    void *mapping = fileSize > 0 ? malloc((size_t)fileSize) : NULL;
+
+    if (mapping == NULL ||
+        fseek(file, 0, SEEK_SET) != 0 ||
+        fread(mapping, 1, (size_t)fileSize, file) != (size_t)fileSize)
+    {
+        fprintf(stderr, "Failed to read the predictive parsing table file %s\n", path);
+        free(mapping);
+        fclose(file);
+        return CCB_ERROR;
+    }
+
+    fclose(file);
+
+    *mappingPtr = mapping;
+    *mappingSizePtr = (size_t)fileSize;
 
     return CCB_SUCCESS;
+#endif
+}
+
+static void sUnmapFile(void *mapping, size_t mappingSize)
+{
+#ifdef HAS_MMAP
+    munmap(mapping, mappingSize);
+#else
+    (void)mappingSize;
+    free(mapping);
+#endif
 }
 
 void PrdcPrsnTble__del(PrdcPrsnTble *self)
 {
-    for (uint8_t prdcPrsnTbleIndex = 0; prdcPrsnTbleIndex < CCB_NUM_OF_NONTERMINALS; prdcPrsnTbleIndex++)
+    if (self->kSeqMaps != NULL)
+    {
+        for (size_t prdcPrsnTbleIndex = 0; prdcPrsnTbleIndex < self->numOfNonterminals; prdcPrsnTbleIndex++)
+        {
+            if (self->kSeqMaps[prdcPrsnTbleIndex] != NULL)
+            {
+                HashMap__del(self->kSeqMaps[prdcPrsnTbleIndex]);
+            }
+        }
+
+        free(self->kSeqMaps);
+    }
+
+    if (self->mapping != NULL)
+    {
+        sUnmapFile(self->mapping, self->mappingSize);
+    }
+    else
     {
-        HashMap__del((HashMap *)self[prdcPrsnTbleIndex]);
+        free(self->ll1Table);
+        free(self->trieNodes);
+        free(self->trieChildren);
+        free(self->trieRoots);
     }
 
     free(self);
 }
 
-void PrdcPrsnTble__log(PrdcPrsnTble *self)
+/* Writes the sequences predicted from the trie state reached by the `depth` tokens of `kSeq`,
+padded with empty strings */
+static void sPrdcPrsnTble__printTrieOptions(
+    PrdcPrsnTble *self,
+    uint32_t nodeIndex,
+    CCB_terminal_t *kSeq,
+    uint8_t depth,
+    FILE *stream)
 {
-    const char *loggerName = "PrdcPrsnTble__log";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
+    if (depth > 0 && self->trieNodes[nodeIndex].production >= 0)
+    {
+        fprintf(stream, "\t(");
+
+        for (uint8_t kSeqIx = 0; kSeqIx < self->k; kSeqIx++)
+        {
+            fprintf(
+                stream,
+                "T%lu, ",
+                (unsigned long)(kSeqIx < depth ? kSeq[kSeqIx] : CCB_EMPTY_STRING_TR));
+        }
+
+        fprintf(stream, ")\n");
+    }
+
+    if (depth == self->k)
+    {
+        return;
+    }
+
+    for (size_t terminal = 0; terminal < self->numOfTerminals; terminal++)
+    {
+        uint32_t childIndex = PrdcPrsnTble__getTrieChild(self, nodeIndex, terminal);
+
+        if (childIndex != 0)
+        {
+            kSeq[depth] = (CCB_terminal_t)terminal;
+            sPrdcPrsnTble__printTrieOptions(self, childIndex, kSeq, depth + 1, stream);
+        }
+    }
+}
 
-    if (logger == NULL)
+void PrdcPrsnTble__printOptions(
+    PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    FILE *stream)
+{
+    if (self->k == 1)
     {
-        fprintf(stderr, "Failed to create logger '%s'\n", loggerName);
+        for (size_t terminal = 0; terminal < self->numOfTerminals; terminal++)
+        {
+            if (PrdcPrsnTble__getLL1Item(self, nonterminal, terminal) >= 0)
+            {
+                fprintf(stream, "\t(T%zu, )\n", terminal);
+            }
+        }
+
         return;
     }
 
+    CCB_terminal_t kSeq[self->k];
+
+    sPrdcPrsnTble__printTrieOptions(self, self->trieRoots[nonterminal], kSeq, 0, stream);
+}
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+/* Grows the buffer until `length` more bytes fit after `offset` */
+static int8_t sPrdcPrsnTble__reserveLogBuffer(
+    char **bufferPtr,
+    size_t *bufferSizePtr,
+    size_t offset,
+    size_t length)
+{
+    size_t newBufferSize = *bufferSizePtr;
+
+    while (offset + length >= newBufferSize)
+    {
+        newBufferSize *= 2;
+    }
+
+    if (newBufferSize == *bufferSizePtr)
+    {
+        return CCB_SUCCESS;
+    }
+
+    char *newBuffer = realloc(*bufferPtr, newBufferSize);
+    if (newBuffer == NULL)
+    {
+        fprintf(stderr, "Failed to reallocate buffer for logging\n");
+        return CCB_ERROR;
+    }
+
+    *bufferPtr = newBuffer;
+    *bufferSizePtr = newBufferSize;
+
+    return CCB_SUCCESS;
+}
+
+static void sPrdcPrsnTble__log(PrdcPrsnTble *self)
+{
     size_t bufferSize = 4096;
     char *buffer = malloc(bufferSize);
     if (buffer == NULL)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
+        CCB_LOG_ERROR(
+            CCB_PRDCPRSNTBLE_LM,
             "Failed to allocate buffer for logging\n",
             39);
-        ClnLogger__del(logger);
         return;
     }
 
     size_t offset = snprintf(buffer, bufferSize, "Predictive Parsing Table:\n");
 
-    for (uint8_t ntIndex = 0; ntIndex < CCB_NUM_OF_NONTERMINALS; ntIndex++)
+    for (size_t ntIndex = 0; ntIndex < self->numOfNonterminals; ntIndex++)
     {
-        HashMap *ntHashMap = (HashMap *)self[ntIndex];
-
-        if (ntHashMap == NULL || ntHashMap->nentries == 0)
+        if (sPrdcPrsnTble__reserveLogBuffer(&buffer, &bufferSize, offset, 256) <= CCB_ERROR)
         {
-            continue;
+            free(buffer);
+            return;
         }
 
-        if (offset >= bufferSize - 256)
+        if (self->k == 1)
         {
-            bufferSize *= 2;
-            char *newBuffer = realloc(buffer, bufferSize);
-            if (newBuffer == NULL)
+            offset += snprintf(buffer + offset, bufferSize - offset, "  NT%zu:\n", ntIndex);
+
+            for (size_t terminal = 0; terminal < self->numOfTerminals; terminal++)
             {
-                fprintf(stderr, "Failed to reallocate buffer for logging\n");
-                free(buffer);
-                ClnLogger__del(logger);
-                return;
+                CCB_production_t production = PrdcPrsnTble__getLL1Item(
+                    self,
+                    ntIndex,
+                    terminal);
+
+                if (production < 0)
+                {
+                    continue;
+                }
+
+                if (sPrdcPrsnTble__reserveLogBuffer(&buffer, &bufferSize, offset, 256) <= CCB_ERROR)
+                {
+                    free(buffer);
+                    return;
+                }
+
+                offset += snprintf(
+                    buffer + offset,
+                    bufferSize - offset,
+                    "    [T%zu] -> P%ld\n",
+                    terminal,
+                    (long)production);
             }
-            buffer = newBuffer;
+
+            continue;
+        }
+
+        HashMap *ntHashMap = self->kSeqMaps[ntIndex];
+
+        if (ntHashMap == NULL || ntHashMap->nentries == 0)
+        {
+            continue;
         }
 
-        offset += snprintf(buffer + offset, bufferSize - offset, "  NT%d:\n", ntIndex);
+        offset += snprintf(buffer + offset, bufferSize - offset, "  NT%zu:\n", ntIndex);
 
         HashMapEntry **entries = HashMap__getEntries(ntHashMap);
 
@@ -408,24 +664,21 @@ void PrdcPrsnTble__log(PrdcPrsnTble *self)
                 continue;
             }
 
-            if (offset >= bufferSize - 256)
-            {
-                bufferSize *= 2;
-                char *newBuffer = realloc(buffer, bufferSize);
-                if (newBuffer == NULL)
-                {
-                    fprintf(stderr, "Failed to reallocate buffer for logging\n");
-                    free(buffer);
-                    ClnLogger__del(logger);
-                    return;
-                }
-                buffer = newBuffer;
-            }
-
             CCB_terminal_t *kSeq = (CCB_terminal_t *)entry->key;
             CCB_production_t *production = (CCB_production_t *)entry->value;
             uint8_t k = entry->keySize / sizeof(CCB_terminal_t);
 
+            /* "    [", up to 13 chars of "T%lu, " per terminal, and "] -> P%ld\n" */
+            if (sPrdcPrsnTble__reserveLogBuffer(
+                    &buffer,
+                    &bufferSize,
+                    offset,
+                    5 + k * 13 + 20) <= CCB_ERROR)
+            {
+                free(buffer);
+                return;
+            }
+
             offset += snprintf(buffer + offset, bufferSize - offset, "    [");
 
             for (uint8_t i = 0; i < k; i++)
@@ -434,69 +687,347 @@ void PrdcPrsnTble__log(PrdcPrsnTble *self)
                 {
                     offset += snprintf(buffer + offset, bufferSize - offset, ", ");
                 }
-                offset += snprintf(buffer + offset, bufferSize - offset, "T%d", kSeq[i]);
+                offset += snprintf(
+                    buffer + offset,
+                    bufferSize - offset,
+                    "T%lu",
+                    (unsigned long)kSeq[i]);
             }
 
-            offset += snprintf(buffer + offset, bufferSize - offset, "] -> P%d\n", *production);
+            offset += snprintf(
+                buffer + offset,
+                bufferSize - offset,
+                "] -> P%ld\n",
+                (long)*production);
         }
     }
 
-    ClnLogger__log(logger, CLN_DEBUG_LL, buffer, offset);
+    CCB_LOG_DEBUG(CCB_PRDCPRSNTBLE_LM, "%s", offset + 1, buffer);
 
     free(buffer);
-    ClnLogger__del(logger);
 }
+#endif
 
-PrdcPrsnTble *PrdcPrsnTble__new(ProductionsHashMap *productions, uint8_t k)
+static int8_t sPrdcPrsnTble__allocateKSeqMaps(PrdcPrsnTble *self)
 {
-    FirstFollowEntry **first = First__new(productions, k);
-
-    if (first == NULL)
-    {
-        return NULL;
-    }
-
-    FirstFollowEntry **follow = Follow__new(productions, first, k);
-
-    if (follow == NULL)
-    {
-        FirstFollow__del(first);
-        return NULL;
-    }
+    self->kSeqMaps = calloc(self->numOfNonterminals, sizeof(HashMap *));
 
-    PrdcPrsnTble *prdtPrsnTable = malloc(
-        sizeof(PrdcPrsnTble) * CCB_NUM_OF_NONTERMINALS);
-
-    if (prdtPrsnTable == NULL)
+    if (self->kSeqMaps == NULL)
     {
         fprintf(stderr, "Failed to allocate memory for the predictive parsing table\n");
-        FirstFollow__del(first);
-        FirstFollow__del(follow);
-        return NULL;
+        return CCB_ERROR;
     }
 
-    for (uint8_t nonTerminalSlot = 0;
-         nonTerminalSlot < CCB_NUM_OF_NONTERMINALS;
+    for (size_t nonTerminalSlot = 0;
+         nonTerminalSlot < self->numOfNonterminals;
          nonTerminalSlot++)
     {
-        prdtPrsnTable[nonTerminalSlot] = HashMap__new(LOG2_MINSIZE);
+        self->kSeqMaps[nonTerminalSlot] = HashMap__new(LOG2_MINSIZE);
 
-        if (prdtPrsnTable[nonTerminalSlot] == NULL)
+        if (self->kSeqMaps[nonTerminalSlot] == NULL)
         {
             fprintf(
                 stderr,
-                "Failed to allocate memory for the nonterminal %d in the predictive parsing table\n",
+                "Failed to allocate memory for the nonterminal %zu in the predictive parsing table\n",
                 nonTerminalSlot);
-            FirstFollow__del(follow);
-            FirstFollow__del(first);
-            PrdcPrsnTble__del(prdtPrsnTable);
-
-            return NULL;
+            return CCB_ERROR;
         }
     }
 
-    if (sPopulatePrdtPrsnTable(
-            prdtPrsnTable, first, follow, productions, k) == CCB_ERROR)
+    return CCB_SUCCESS;
+}
+
+static int8_t sPrdcPrsnTble__allocateLL1Table(PrdcPrsnTble *self)
+{
+    size_t numOfCells = self->numOfNonterminals * self->numOfTerminals;
+
+    self->ll1Table = malloc(numOfCells * sizeof(CCB_production_t));
+
+    if (self->ll1Table == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the LL(1) predictive parsing table\n");
+        return CCB_ERROR;
+    }
+
+    for (size_t cellIndex = 0; cellIndex < numOfCells; cellIndex++)
+    {
+        self->ll1Table[cellIndex] = CCB_ERROR_PR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+/* Marks a trie state whose subtree can only produce more than one prediction */
+#define MIXED_PREDICTIONS_PR (CCB_production_t)-2
+
+static int8_t sPrdcPrsnTble__newTrieNode(PrdcPrsnTble *self, uint32_t *nodeIndexPtr)
+{
+    if ((self->numOfTrieNodes & (self->numOfTrieNodes - 1)) == 0)
+    {
+        uint32_t capacity = self->numOfTrieNodes == 0 ? 1 : self->numOfTrieNodes * 2;
+        PrdcTrieNode *newNodes = realloc(self->trieNodes, capacity * sizeof(PrdcTrieNode));
+
+        if (newNodes == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the prediction trie\n");
+            return CCB_ERROR;
+        }
+
+        self->trieNodes = newNodes;
+
+        uint32_t *newChildren = realloc(
+            self->trieChildren,
+            (size_t)capacity * self->numOfTerminals * sizeof(uint32_t));
+
+        if (newChildren == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the prediction trie\n");
+            return CCB_ERROR;
+        }
+
+        self->trieChildren = newChildren;
+    }
+
+    PrdcTrieNode *node = &self->trieNodes[self->numOfTrieNodes];
+
+    /* Padding is cleared too, so saved tables are the same for the same grammar */
+    memset(node, 0x0, sizeof(PrdcTrieNode));
+    node->production = CCB_ERROR_PR;
+    node->isDecisive = false;
+
+    memset(
+        &self->trieChildren[(size_t)self->numOfTrieNodes * self->numOfTerminals],
+        0x0,
+        self->numOfTerminals * sizeof(uint32_t));
+
+    *nodeIndexPtr = self->numOfTrieNodes++;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sPrdcPrsnTble__insertTrieKSeq(
+    PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    CCB_terminal_t *kSeq,
+    CCB_production_t production)
+{
+    /* Trailing empty strings pad sequences shorter than `k`, so they end the walk */
+    uint8_t kSeqLen = self->k;
+
+    while (kSeqLen > 1 && kSeq[kSeqLen - 1] == CCB_EMPTY_STRING_TR)
+    {
+        kSeqLen--;
+    }
+
+    uint32_t nodeIndex = self->trieRoots[nonterminal];
+
+    for (uint8_t depth = 0; depth < kSeqLen; depth++)
+    {
+        size_t childSlot = (size_t)nodeIndex * self->numOfTerminals + kSeq[depth];
+        uint32_t childIndex = self->trieChildren[childSlot];
+
+        if (childIndex == 0)
+        {
+            if (sPrdcPrsnTble__newTrieNode(self, &childIndex) <= CCB_ERROR)
+            {
+                return CCB_ERROR;
+            }
+
+            self->trieChildren[childSlot] = childIndex;
+        }
+
+        nodeIndex = childIndex;
+    }
+
+    self->trieNodes[nodeIndex].production = production;
+
+    return CCB_SUCCESS;
+}
+
+/* Returns the only prediction reachable from the state, `MIXED_PREDICTIONS_PR` if there is
+more than one, or `CCB_ERROR_PR` if there is none */
+static CCB_production_t sPrdcPrsnTble__markDecisiveTrieNodes(
+    PrdcPrsnTble *self,
+    uint32_t nodeIndex)
+{
+    CCB_production_t reachable = self->trieNodes[nodeIndex].production;
+
+    for (size_t terminal = 0; terminal < self->numOfTerminals; terminal++)
+    {
+        uint32_t childIndex = PrdcPrsnTble__getTrieChild(self, nodeIndex, terminal);
+
+        if (childIndex == 0)
+        {
+            continue;
+        }
+
+        CCB_production_t childReachable = sPrdcPrsnTble__markDecisiveTrieNodes(
+            self,
+            childIndex);
+
+        if (reachable == CCB_ERROR_PR)
+        {
+            reachable = childReachable;
+        }
+        else if (childReachable != CCB_ERROR_PR && childReachable != reachable)
+        {
+            reachable = MIXED_PREDICTIONS_PR;
+        }
+    }
+
+    PrdcTrieNode *node = &self->trieNodes[nodeIndex];
+    node->isDecisive = node->production >= 0 && node->production == reachable;
+
+    return reachable;
+}
+
+/* Compiles the `k`-sequences of each nonterminal into a trie that is walked one lookahead
+token at a time */
+static int8_t sPrdcPrsnTble__compileTrie(PrdcPrsnTble *self)
+{
+    self->trieRoots = calloc(self->numOfNonterminals, sizeof(uint32_t));
+
+    if (self->trieRoots == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the prediction trie roots\n");
+        return CCB_ERROR;
+    }
+
+    uint32_t sinkIndex;
+
+    if (sPrdcPrsnTble__newTrieNode(self, &sinkIndex) <= CCB_ERROR)
+    {
+        return CCB_ERROR;
+    }
+
+    for (size_t ntIndex = 0; ntIndex < self->numOfNonterminals; ntIndex++)
+    {
+        uint32_t rootIndex;
+
+        if (sPrdcPrsnTble__newTrieNode(self, &rootIndex) <= CCB_ERROR)
+        {
+            return CCB_ERROR;
+        }
+
+        self->trieRoots[ntIndex] = rootIndex;
+
+        HashMap *ntHashMap = self->kSeqMaps[ntIndex];
+        HashMapEntry **entries = HashMap__getEntries(ntHashMap);
+
+        for (ssize_t entryIndex = 0; entryIndex < ntHashMap->nentries; entryIndex++)
+        {
+            HashMapEntry *entry = entries[entryIndex];
+
+            if (entry == NULL || entry->key == NULL || entry->value == NULL)
+            {
+                continue;
+            }
+
+            if (sPrdcPrsnTble__insertTrieKSeq(
+                    self,
+                    ntIndex,
+                    entry->key,
+                    *(CCB_production_t *)entry->value) <= CCB_ERROR)
+            {
+                return CCB_ERROR;
+            }
+        }
+
+        sPrdcPrsnTble__markDecisiveTrieNodes(self, rootIndex);
+    }
+
+    return CCB_SUCCESS;
+}
+
+CCB_production_t PrdcPrsnTble__predict(
+    const PrdcPrsnTble *self,
+    CCB_nonterminal_t nonterminal,
+    const CCB_terminal_t *lookahead,
+    uint8_t *prefixLengthPtr)
+{
+    *prefixLengthPtr = 1;
+
+    if (self->k == 1)
+    {
+        return PrdcPrsnTble__getLL1Item(self, nonterminal, lookahead[0]);
+    }
+
+    const PrdcTrieNode *nodes = self->trieNodes;
+    uint32_t nodeIndex = self->trieRoots[nonterminal];
+    CCB_production_t production = CCB_ERROR_PR;
+
+    for (uint8_t depth = 0; depth < self->k; depth++)
+    {
+        nodeIndex = PrdcPrsnTble__getTrieChild(self, nodeIndex, lookahead[depth]);
+
+        if (nodeIndex == 0)
+        {
+            break;
+        }
+
+        if (nodes[nodeIndex].production >= 0)
+        {
+            production = nodes[nodeIndex].production;
+            *prefixLengthPtr = depth + 1;
+
+            if (nodes[nodeIndex].isDecisive)
+            {
+                break;
+            }
+        }
+    }
+
+    return production;
+}
+
+PrdcPrsnTble *PrdcPrsnTble__new(ProductionsHashMap *productions, uint8_t k)
+{
+    PrdcPrsnTble *prdtPrsnTable = calloc(1, sizeof(PrdcPrsnTble));
+
+    if (prdtPrsnTable == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the predictive parsing table\n");
+        return NULL;
+    }
+
+    prdtPrsnTable->k = k;
+    sPrdcPrsnTble__measure(prdtPrsnTable, productions);
+
+    FirstFollow *first = First__new(
+        productions,
+        prdtPrsnTable->numOfNonterminals,
+        prdtPrsnTable->numOfTerminals,
+        k);
+
+    if (first == NULL)
+    {
+        PrdcPrsnTble__del(prdtPrsnTable);
+        return NULL;
+    }
+
+    FirstFollow *follow = Follow__new(productions, first, k);
+
+    if (follow == NULL)
+    {
+        FirstFollow__del(first);
+        PrdcPrsnTble__del(prdtPrsnTable);
+        return NULL;
+    }
+
+    int8_t allocationResult = k == 1
+                                  ? sPrdcPrsnTble__allocateLL1Table(prdtPrsnTable)
+                                  : sPrdcPrsnTble__allocateKSeqMaps(prdtPrsnTable);
+
+    if (allocationResult <= CCB_ERROR)
+    {
+        FirstFollow__del(follow);
+        FirstFollow__del(first);
+        PrdcPrsnTble__del(prdtPrsnTable);
+        return NULL;
+    }
+
+    if (sPopulatePrdtPrsnTable(
+            prdtPrsnTable, first, follow, productions, k) == CCB_ERROR)
     {
         FirstFollow__del(follow);
         FirstFollow__del(first);
@@ -504,7 +1035,326 @@ PrdcPrsnTble *PrdcPrsnTble__new(ProductionsHashMap *productions, uint8_t k)
         return NULL;
     }
 
-    PrdcPrsnTble__log(prdtPrsnTable);
+    FirstFollow__del(follow);
+    FirstFollow__del(first);
+
+    if (k > 1 && sPrdcPrsnTble__compileTrie(prdtPrsnTable) <= CCB_ERROR)
+    {
+        PrdcPrsnTble__del(prdtPrsnTable);
+        return NULL;
+    }
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+    sPrdcPrsnTble__log(prdtPrsnTable);
+#endif
 
     return prdtPrsnTable;
 }
+
+#define TABLE_FILE_MAGIC "CCBT"
+#define TABLE_FILE_VERSION 2
+#define TABLE_FILE_BYTE_ORDER_MARK 0x01020304
+
+/* Header of the files written by `PrdcPrsnTble__save`. Every field is naturally aligned and the
+header size is a multiple of 8, so the sections following it can be used in place */
+typedef struct PrdcPrsnTbleFileHeader
+{
+    char magic[4];
+
+    /* Read back as another value when the file was written on a machine with another byte
+    order */
+    uint32_t byteOrderMark;
+
+    uint16_t version;
+    uint8_t k;
+    uint8_t terminalSize;
+    uint8_t productionSize;
+    uint8_t reserved[3];
+    uint32_t numOfNonterminals;
+    uint32_t numOfTerminals;
+    uint32_t numOfTrieNodes;
+    uint32_t trieNodeSize;
+    uint64_t grammarHash;
+
+    /* Number of bytes after the header, and their checksum */
+    uint64_t payloadSize;
+    uint64_t checksum;
+} PrdcPrsnTbleFileHeader;
+
+typedef struct PrdcPrsnTbleSection
+{
+    const void *data;
+    size_t size;
+} PrdcPrsnTbleSection;
+
+/* Lists the arrays stored after the header, in file order, and returns how many there are */
+static size_t sPrdcPrsnTble__getSections(
+    const PrdcPrsnTble *self,
+    PrdcPrsnTbleSection *sections)
+{
+    if (self->k == 1)
+    {
+        sections[0].data = self->ll1Table;
+        sections[0].size = self->numOfNonterminals *
+                           self->numOfTerminals *
+                           sizeof(CCB_production_t);
+        return 1;
+    }
+
+    /* The states go last, since they may not be a multiple of 4 bytes */
+    sections[0].data = self->trieRoots;
+    sections[0].size = self->numOfNonterminals * sizeof(uint32_t);
+    sections[1].data = self->trieChildren;
+    sections[1].size = (size_t)self->numOfTrieNodes * self->numOfTerminals * sizeof(uint32_t);
+    sections[2].data = self->trieNodes;
+    sections[2].size = self->numOfTrieNodes * sizeof(PrdcTrieNode);
+    return 3;
+}
+
+int8_t PrdcPrsnTble__save(const PrdcPrsnTble *self, uint64_t grammarHash, const char *path)
+{
+    PrdcPrsnTbleSection sections[3];
+    size_t numOfSections = sPrdcPrsnTble__getSections(self, sections);
+
+    PrdcPrsnTbleFileHeader header;
+    memset(&header, 0x0, sizeof(PrdcPrsnTbleFileHeader));
+    memcpy(header.magic, TABLE_FILE_MAGIC, sizeof(header.magic));
+    header.byteOrderMark = TABLE_FILE_BYTE_ORDER_MARK;
+    header.version = TABLE_FILE_VERSION;
+    header.k = self->k;
+    header.terminalSize = sizeof(CCB_terminal_t);
+    header.productionSize = sizeof(CCB_production_t);
+    header.numOfNonterminals = (uint32_t)self->numOfNonterminals;
+    header.numOfTerminals = (uint32_t)self->numOfTerminals;
+    header.numOfTrieNodes = self->numOfTrieNodes;
+    header.trieNodeSize = sizeof(PrdcTrieNode);
+    header.grammarHash = grammarHash;
+    header.checksum = CCB_CHECKSUM_SEED;
+
+    for (size_t sectionIndex = 0; sectionIndex < numOfSections; sectionIndex++)
+    {
+        header.payloadSize += sections[sectionIndex].size;
+        header.checksum = CCB_checksum(
+            header.checksum,
+            sections[sectionIndex].data,
+            sections[sectionIndex].size);
+    }
+
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to create the predictive parsing table file %s\n", path);
+        return CCB_ERROR;
+    }
+
+    bool wasWritten = fwrite(&header, sizeof(PrdcPrsnTbleFileHeader), 1, file) == 1;
+
+    for (size_t sectionIndex = 0; wasWritten && sectionIndex < numOfSections; sectionIndex++)
+    {
+        wasWritten = fwrite(
+                         sections[sectionIndex].data,
+                         1,
+                         sections[sectionIndex].size,
+                         file) == sections[sectionIndex].size;
+    }
+
+    if (fclose(file) != 0 || !wasWritten)
+    {
+        fprintf(stderr, "Failed to write the predictive parsing table file %s\n", path);
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sPrdcPrsnTble__checkFileHeader(
+    const PrdcPrsnTbleFileHeader *header,
+    size_t fileSize,
+    uint64_t grammarHash,
+    size_t numOfNonterminals)
+{
+    if (memcmp(header->magic, TABLE_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->byteOrderMark != TABLE_FILE_BYTE_ORDER_MARK)
+    {
+        fprintf(stderr, "Not a predictive parsing table file for this machine\n");
+        return CCB_ERROR;
+    }
+
+    if (header->version != TABLE_FILE_VERSION)
+    {
+        fprintf(stderr, "Unsupported predictive parsing table file version %d\n", header->version);
+        return CCB_ERROR;
+    }
+
+    if (header->k == 0 ||
+        header->terminalSize != sizeof(CCB_terminal_t) ||
+        header->productionSize != sizeof(CCB_production_t) ||
+        header->numOfNonterminals == 0 ||
+        header->numOfTerminals == 0 ||
+        header->trieNodeSize != sizeof(PrdcTrieNode))
+    {
+        fprintf(stderr, "Predictive parsing table file was written by an incompatible build\n");
+        return CCB_ERROR;
+    }
+
+    if (header->grammarHash != grammarHash || header->numOfNonterminals != numOfNonterminals)
+    {
+        fprintf(stderr, "Predictive parsing table file was written for another grammar\n");
+        return CCB_ERROR;
+    }
+
+    uint64_t expectedPayloadSize =
+        header->k == 1
+            ? (uint64_t)header->numOfNonterminals * header->numOfTerminals * sizeof(CCB_production_t)
+            : (uint64_t)header->numOfNonterminals * sizeof(uint32_t) +
+                  (uint64_t)header->numOfTrieNodes * header->numOfTerminals * sizeof(uint32_t) +
+                  (uint64_t)header->numOfTrieNodes * sizeof(PrdcTrieNode);
+
+    if (header->payloadSize != expectedPayloadSize ||
+        fileSize - sizeof(PrdcPrsnTbleFileHeader) != header->payloadSize)
+    {
+        fprintf(stderr, "Predictive parsing table file is truncated\n");
+        return CCB_ERROR;
+    }
+
+    const uint8_t *payload = (const uint8_t *)header + sizeof(PrdcPrsnTbleFileHeader);
+
+    if (CCB_checksum(CCB_CHECKSUM_SEED, payload, header->payloadSize) != header->checksum)
+    {
+        fprintf(stderr, "Predictive parsing table file is corrupted\n");
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+/* Makes sure every trie transition stays inside the trie, so walking it never reads past the
+mapping */
+static int8_t sPrdcPrsnTble__checkTrie(const PrdcPrsnTble *self)
+{
+    for (size_t ntIndex = 0; ntIndex < self->numOfNonterminals; ntIndex++)
+    {
+        if (self->trieRoots[ntIndex] >= self->numOfTrieNodes)
+        {
+            fprintf(stderr, "Predictive parsing table file has an invalid trie\n");
+            return CCB_ERROR;
+        }
+    }
+
+    size_t numOfChildren = (size_t)self->numOfTrieNodes * self->numOfTerminals;
+
+    for (size_t childSlot = 0; childSlot < numOfChildren; childSlot++)
+    {
+        if (self->trieChildren[childSlot] >= self->numOfTrieNodes)
+        {
+            fprintf(stderr, "Predictive parsing table file has an invalid trie\n");
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+static bool sIsProductionValid(CCB_production_t production, size_t numOfProductions)
+{
+    return production == CCB_ERROR_PR ||
+           (production >= 0 && (size_t)production < numOfProductions);
+}
+
+/* Makes sure every production the table predicts is one of the grammar, since they index its
+productions table */
+static int8_t sPrdcPrsnTble__checkProductions(const PrdcPrsnTble *self, size_t numOfProductions)
+{
+    size_t numOfCells = self->k == 1
+                            ? self->numOfNonterminals * self->numOfTerminals
+                            : self->numOfTrieNodes;
+
+    for (size_t cell = 0; cell < numOfCells; cell++)
+    {
+        CCB_production_t production = self->k == 1
+                                          ? self->ll1Table[cell]
+                                          : self->trieNodes[cell].production;
+
+        if (!sIsProductionValid(production, numOfProductions))
+        {
+            fprintf(stderr, "Predictive parsing table file predicts an invalid production\n");
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+PrdcPrsnTble *PrdcPrsnTble__load(
+    const char *path,
+    uint64_t grammarHash,
+    size_t numOfNonterminals,
+    size_t numOfProductions)
+{
+    void *mapping;
+    size_t mappingSize;
+
+    if (sMapFile(path, &mapping, &mappingSize) <= CCB_ERROR)
+    {
+        return NULL;
+    }
+
+    const PrdcPrsnTbleFileHeader *header = mapping;
+
+    if (mappingSize < sizeof(PrdcPrsnTbleFileHeader))
+    {
+        fprintf(stderr, "Predictive parsing table file is truncated\n");
+        sUnmapFile(mapping, mappingSize);
+        return NULL;
+    }
+
+    if (sPrdcPrsnTble__checkFileHeader(
+            header,
+            mappingSize,
+            grammarHash,
+            numOfNonterminals) <= CCB_ERROR)
+    {
+        sUnmapFile(mapping, mappingSize);
+        return NULL;
+    }
+
+    PrdcPrsnTble *self = calloc(1, sizeof(PrdcPrsnTble));
+
+    if (self == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the predictive parsing table\n");
+        sUnmapFile(mapping, mappingSize);
+        return NULL;
+    }
+
+    uint8_t *payload = (uint8_t *)mapping + sizeof(PrdcPrsnTbleFileHeader);
+
+    self->k = header->k;
+    self->numOfNonterminals = header->numOfNonterminals;
+    self->numOfTerminals = header->numOfTerminals;
+    self->mapping = mapping;
+    self->mappingSize = mappingSize;
+
+    if (self->k == 1)
+    {
+        self->ll1Table = (CCB_production_t *)payload;
+    }
+    else
+    {
+        self->numOfTrieNodes = header->numOfTrieNodes;
+        self->trieRoots = (uint32_t *)payload;
+        self->trieChildren = self->trieRoots + self->numOfNonterminals;
+        self->trieNodes = (PrdcTrieNode *)(self->trieChildren +
+                                           (size_t)self->numOfTrieNodes * self->numOfTerminals);
+    }
+
+    if ((self->k > 1 && sPrdcPrsnTble__checkTrie(self) <= CCB_ERROR) ||
+        sPrdcPrsnTble__checkProductions(self, numOfProductions) <= CCB_ERROR)
+    {
+        PrdcPrsnTble__del(self);
+        return NULL;
+    }
+
+    return self;
+}
@@ -5,8 +5,7 @@
 #include <cbarroso/constants.h>
 #include <cbarroso/dblylnkdlist.h>
 #include <cbarroso/hashmap.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
+#include <ccabral/_lggr.h>
 #include <ccabral/_prdcdata.h>
 #include <ccabral/_prdsmap.h>
 #include <ccabral/constants.h>
@@ -29,8 +28,8 @@ int8_t ProductionsHashMap__getFirstProdListNodeForTerminal(
     {
         fprintf(
             stderr,
-            "Failed to get productions linked list for nonterminal NT%d",
-            nonterminal);
+            "Failed to get productions linked list for nonterminal NT%lu",
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
 
@@ -47,27 +46,13 @@ int8_t ProductionsHashMap__getProdDataFromNonterminalNRuleId(
 {
     assert(self != NULL);
 
-    const char *loggerName = "ProductionsHashMap__getProdDataFromNonterminalNRuleId";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
-
-    if (logger == NULL)
-    {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n",
-            loggerName);
-        return CCB_ERROR;
-    }
-
     if (production < 0)
     {
-        ClnLogger__log(
-            logger,
-            CLN_CRITICAL_LL,
-            "P%d is not a valid production",
+        CCB_LOG_CRITICAL(
+            CCB_PRDSMAP_LM,
+            "P%ld is not a valid production",
             34,
-            production);
-        ClnLogger__del(logger);
+            (long)production);
 
         return CCB_ERROR;
     }
@@ -80,12 +65,11 @@ int8_t ProductionsHashMap__getProdDataFromNonterminalNRuleId(
             sizeof(CCB_nonterminal_t),
             (void **)&entry) <= CBR_ERROR)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to get productions linked list for nonterminal NT%d\n",
+        CCB_LOG_ERROR(
+            CCB_PRDSMAP_LM,
+            "Failed to get productions linked list for nonterminal NT%lu\n",
             128,
-            nonterminal);
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
 
@@ -97,21 +81,18 @@ int8_t ProductionsHashMap__getProdDataFromNonterminalNRuleId(
         {
             *prodDataAddr = prodData;
 
-            ClnLogger__del(logger);
             return CCB_SUCCESS;
         }
         currentNode = currentNode->next;
     }
 
-    ClnLogger__log(
-        logger,
-        CLN_ERROR_LL,
-        "Failed to find production %d for nonterminal NT%d\n",
+    CCB_LOG_ERROR(
+        CCB_PRDSMAP_LM,
+        "Failed to find production %ld for nonterminal NT%lu\n",
         128,
-        production,
-        nonterminal);
+        (long)production,
+        (unsigned long)nonterminal);
 
-    ClnLogger__del(logger);
     return CCB_ERROR;
 }
 
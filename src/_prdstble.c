@@ -0,0 +1,255 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cbarroso/dblylnkdlist.h>
+#include <cbarroso/hashmap.h>
+#include <ccabral/_chcksm.h>
+#include <ccabral/_grmmdata.h>
+#include <ccabral/_prdcdata.h>
+#include <ccabral/_prdsmap.h>
+#include <ccabral/_prdstble.h>
+#include <ccabral/constants.h>
+
+static int8_t sProductionsTable__measure(
+    ProductionsHashMap *productions,
+    size_t *numOfProductionsPtr,
+    size_t *numOfRightHandsPtr)
+{
+    HashMapEntry **entries = HashMap__getEntries(productions);
+
+    for (ssize_t entryIndex = 0; entryIndex < productions->nentries; entryIndex++)
+    {
+        ProductionsHashMapEntry *prodMapEntry = entries[entryIndex]->value;
+
+        for (
+            DoublyLinkedListNode *currProdNode = prodMapEntry->head;
+            currProdNode != NULL;
+            currProdNode = currProdNode->next)
+        {
+            ProductionData *prodData = currProdNode->value;
+
+            if (prodData->id < 0)
+            {
+                fprintf(stderr, "P%ld is not a valid production\n", (long)prodData->id);
+                return CCB_ERROR;
+            }
+
+            if ((size_t)prodData->id >= *numOfProductionsPtr)
+            {
+                *numOfProductionsPtr = (size_t)prodData->id + 1;
+            }
+
+            for (
+                DoublyLinkedListNode *currGrammarNode = prodData->rightHandHead;
+                currGrammarNode != NULL;
+                currGrammarNode = currGrammarNode->next)
+            {
+                (*numOfRightHandsPtr)++;
+            }
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sProductionsTable__insert(
+    ProductionsTable *self,
+    ProductionData *prodData,
+    bool *isDefined,
+    uint32_t *offsetPtr)
+{
+    if (isDefined[prodData->id])
+    {
+        fprintf(stderr, "P%ld is defined more than once\n", (long)prodData->id);
+        return CCB_ERROR;
+    }
+
+    isDefined[prodData->id] = true;
+
+    size_t rightHandLength = 0;
+
+    for (
+        DoublyLinkedListNode *currGrammarNode = prodData->rightHandTail;
+        currGrammarNode != NULL;
+        currGrammarNode = currGrammarNode->prev)
+    {
+        GrammarData *currGrammar = currGrammarNode->value;
+
+        if (GrammarData__isEmptyString(currGrammar))
+        {
+            continue;
+        }
+
+        if (rightHandLength == UINT8_MAX)
+        {
+            fprintf(stderr, "P%ld right hand side is too long\n", (long)prodData->id);
+            return CCB_ERROR;
+        }
+
+        self->rightHands[*offsetPtr + rightHandLength++] = *currGrammar;
+    }
+
+    self->leftHands[prodData->id] = prodData->leftHand;
+    self->rightHandOffsets[prodData->id] = *offsetPtr;
+    self->rightHandLengths[prodData->id] = (uint8_t)rightHandLength;
+    *offsetPtr += rightHandLength;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sProductionsTable__populate(
+    ProductionsTable *self,
+    ProductionsHashMap *productions)
+{
+    bool *isDefined = calloc(self->numOfProductions, sizeof(bool));
+
+    if (isDefined == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the productions table\n");
+        return CCB_ERROR;
+    }
+
+    HashMapEntry **entries = HashMap__getEntries(productions);
+    uint32_t offset = 0;
+
+    for (ssize_t entryIndex = 0; entryIndex < productions->nentries; entryIndex++)
+    {
+        ProductionsHashMapEntry *prodMapEntry = entries[entryIndex]->value;
+
+        for (
+            DoublyLinkedListNode *currProdNode = prodMapEntry->head;
+            currProdNode != NULL;
+            currProdNode = currProdNode->next)
+        {
+            if (sProductionsTable__insert(
+                    self,
+                    currProdNode->value,
+                    isDefined,
+                    &offset) <= CCB_ERROR)
+            {
+                free(isDefined);
+                return CCB_ERROR;
+            }
+        }
+    }
+
+    free(isDefined);
+    return CCB_SUCCESS;
+}
+
+ProductionsTable *ProductionsTable__new(ProductionsHashMap *productions)
+{
+    size_t numOfProductions = 0;
+    size_t numOfRightHands = 0;
+
+    if (sProductionsTable__measure(
+            productions,
+            &numOfProductions,
+            &numOfRightHands) <= CCB_ERROR)
+    {
+        return NULL;
+    }
+
+    ProductionsTable *self = calloc(1, sizeof(ProductionsTable));
+
+    if (self == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the productions table\n");
+        return NULL;
+    }
+
+    self->numOfProductions = numOfProductions;
+    self->leftHands = calloc(numOfProductions + 1, sizeof(CCB_nonterminal_t));
+    self->rightHandOffsets = calloc(numOfProductions + 1, sizeof(uint32_t));
+    self->rightHandLengths = calloc(numOfProductions + 1, sizeof(uint8_t));
+    self->rightHands = calloc(numOfRightHands + 1, sizeof(GrammarData));
+
+    if (self->leftHands == NULL ||
+        self->rightHandOffsets == NULL ||
+        self->rightHandLengths == NULL ||
+        self->rightHands == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the productions table\n");
+        ProductionsTable__del(self);
+        return NULL;
+    }
+
+    if (sProductionsTable__populate(self, productions) <= CCB_ERROR)
+    {
+        ProductionsTable__del(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+size_t ProductionsTable__getNumOfNonterminals(const ProductionsTable *self)
+{
+    size_t numOfNonterminals = CCB_START_NT + 1;
+
+    for (size_t production = 0; production < self->numOfProductions; production++)
+    {
+        uint8_t rightHandLength;
+        const GrammarData *rightHand = ProductionsTable__getRightHand(
+            self,
+            (CCB_production_t)production,
+            &rightHandLength);
+
+        if ((size_t)self->leftHands[production] >= numOfNonterminals)
+        {
+            numOfNonterminals = (size_t)self->leftHands[production] + 1;
+        }
+
+        for (uint8_t i = 0; i < rightHandLength; i++)
+        {
+            if (rightHand[i].type == CCB_NONTERMINAL_GT &&
+                (size_t)rightHand[i].id >= numOfNonterminals)
+            {
+                numOfNonterminals = (size_t)rightHand[i].id + 1;
+            }
+        }
+    }
+
+    return numOfNonterminals;
+}
+
+uint64_t ProductionsTable__hash(const ProductionsTable *self)
+{
+    uint64_t hash = CCB_checksum(
+        CCB_CHECKSUM_SEED,
+        &self->numOfProductions,
+        sizeof(size_t));
+
+    /* Walked by production id, so the hash does not depend on the order of `rightHands` */
+    for (size_t production = 0; production < self->numOfProductions; production++)
+    {
+        uint8_t rightHandLength;
+        const GrammarData *rightHand = ProductionsTable__getRightHand(
+            self,
+            (CCB_production_t)production,
+            &rightHandLength);
+
+        hash = CCB_checksum(hash, &self->leftHands[production], sizeof(CCB_nonterminal_t));
+        hash = CCB_checksum(hash, &rightHandLength, sizeof(uint8_t));
+
+        /* Field by field, since the padding of `GrammarData` is copied from the caller and
+        holds indeterminate bytes when the ids are wider than the grammar type */
+        for (uint8_t i = 0; i < rightHandLength; i++)
+        {
+            hash = CCB_checksum(hash, &rightHand[i].id, sizeof(CCB_grammar_t));
+            hash = CCB_checksum(hash, &rightHand[i].type, sizeof(CCB_grammartype_t));
+        }
+    }
+
+    return hash;
+}
+
+void ProductionsTable__del(ProductionsTable *self)
+{
+    free(self->leftHands);
+    free(self->rightHandOffsets);
+    free(self->rightHandLengths);
+    free(self->rightHands);
+    free(self);
+}
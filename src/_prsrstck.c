@@ -2,141 +2,66 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <cbarroso/stack.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
 #include <ccabral/types.h>
 #include <ccabral/constants.h>
 #include <ccabral/_prsrstck.h>
 
-int8_t ParserStack__push(ParserStack *self,
-                         CCB_grammar_t newValue,
-                         CCB_grammartype_t grammarType)
+#define INITIAL_CAPACITY 64
+
+int8_t ParserStack__reserve(ParserStack *self, size_t numOfGrammars)
 {
     assert(self != NULL);
 
-    const char *loggerName = "ParserStack__push";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
-
-    if (logger == NULL)
+    if (self->capacity - self->stackSize >= numOfGrammars)
     {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n", loggerName);
-
-        return false;
+        return CCB_SUCCESS;
     }
 
-    GrammarData *gd = malloc(sizeof(GrammarData));
+    size_t newCapacity = self->capacity == 0 ? INITIAL_CAPACITY : self->capacity;
 
-    if (gd == NULL)
+    while (newCapacity - self->stackSize < numOfGrammars)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to allocate memory for GrammarData",
-            41);
-        ClnLogger__del(logger);
-        return CCB_ERROR;
+        newCapacity *= 2;
     }
 
-    gd->id = newValue;
-    gd->type = grammarType;
+    GrammarData *newGrammars = realloc(self->grammars, newCapacity * sizeof(GrammarData));
 
-    if (Stack__push(self, gd, sizeof(GrammarData)) == -1)
+    if (newGrammars == NULL)
     {
-        ClnLogger__log(logger, CLN_ERROR_LL, "Failed to push to stack", 23);
-        free(gd);
-        ClnLogger__del(logger);
+        fprintf(stderr, "Failed to grow the parser stack to %zu grammars\n", newCapacity);
         return CCB_ERROR;
     }
 
-    char *grammarDataStr = GrammarData__str(gd);
+    self->grammars = newGrammars;
+    self->capacity = newCapacity;
 
-    if (grammarDataStr == NULL)
-    {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to strigify popped grammar",
-            33);
-
-        free(gd);
-        ClnLogger__del(logger);
-        return CCB_ERROR;
-    }
-
-    ClnLogger__log(
-        logger,
-        CLN_DEBUG_LL,
-        "Pushed %s",
-        10,
-        grammarDataStr);
-
-    free(grammarDataStr);
-    ClnLogger__del(logger);
+#ifdef CCB_ENABLE_STATS
+    self->numOfAllocations++;
+#endif
 
     return CCB_SUCCESS;
 }
 
-int8_t ParserStack__pop(ParserStack *self,
-                        GrammarData **value)
+int8_t ParserStack__pushMany(ParserStack *self,
+                             const GrammarData *grammars,
+                             size_t numOfGrammars)
 {
     assert(self != NULL);
 
-    const char *loggerName = "ParserStack__pop";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
-
-    if (logger == NULL)
-    {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n", loggerName);
-
-        return false;
-    }
-
-    if (Stack__pop(self, (void **)value) == -1)
+    if (ParserStack__reserve(self, numOfGrammars) <= CCB_ERROR)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to pop from stack",
-            24);
-
-        ClnLogger__del(logger);
         return CCB_ERROR;
     }
 
-    char *grammarDataStr = GrammarData__str(*value);
-
-    if (grammarDataStr == NULL)
-    {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to strigify popped grammar",
-            33);
-
-        ClnLogger__del(logger);
-        return CCB_ERROR;
-    }
-
-    ClnLogger__log(
-        logger,
-        CLN_DEBUG_LL,
-        "Popped %s",
-        10,
-        grammarDataStr);
-
-    ClnLogger__del(logger);
+    memcpy(&self->grammars[self->stackSize], grammars, numOfGrammars * sizeof(GrammarData));
+    self->stackSize += numOfGrammars;
 
     return CCB_SUCCESS;
 }
 
 ParserStack *ParserStack__new()
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = calloc(1, sizeof(ParserStack));
 
     if (stack == NULL)
     {
@@ -144,12 +69,22 @@ ParserStack *ParserStack__new()
         return NULL;
     }
 
+#ifdef CCB_ENABLE_STATS
+    stack->numOfAllocations = 1;
+#endif
+
     if (ParserStack__push(stack, CCB_END_OF_TEXT_TR, CCB_TERMINAL_GT) == CCB_ERROR)
     {
         fprintf(stderr, "Failed to push end of text terminal to the parser stack\n");
-        Stack__del(stack);
+        ParserStack__del(stack);
         return NULL;
     }
 
     return stack;
 }
+
+void ParserStack__del(ParserStack *self)
+{
+    free(self->grammars);
+    free(self);
+}
@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <ccabral/_cst.h>
+#include <ccabral/constants.h>
+#include <ccabral/cst.h>
+
+#define DEFAULT_CAPACITY (size_t)1024
+
+/* Reallocates `*array` to `capacity` elements of `elementSize` bytes, leaving it as it was on
+failure */
+static int8_t sResize(void **array, size_t capacity, size_t elementSize)
+{
+    void *newArray = realloc(*array, capacity * elementSize);
+
+    if (newArray == NULL)
+    {
+        return CCB_ERROR;
+    }
+
+    *array = newArray;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sConcreteSyntaxTree__resize(ConcreteSyntaxTree *self, size_t capacity)
+{
+    if (sResize((void **)&self->productions, capacity, sizeof(CCB_production_t)) <= CCB_ERROR ||
+        sResize((void **)&self->terminals, capacity, sizeof(CCB_terminal_t)) <= CCB_ERROR ||
+        sResize((void **)&self->parents, capacity, sizeof(size_t)) <= CCB_ERROR ||
+        sResize((void **)&self->firstChildren, capacity, sizeof(size_t)) <= CCB_ERROR ||
+        sResize((void **)&self->nextSiblings, capacity, sizeof(size_t)) <= CCB_ERROR ||
+        sResize((void **)&self->tokenStarts, capacity, sizeof(size_t)) <= CCB_ERROR ||
+        sResize((void **)&self->tokenEnds, capacity, sizeof(size_t)) <= CCB_ERROR)
+    {
+        fprintf(stderr, "Failed to grow the concrete syntax tree to %zu nodes\n", capacity);
+        return CCB_ERROR;
+    }
+
+    self->capacity = capacity;
+
+    return CCB_SUCCESS;
+}
+
+ConcreteSyntaxTree *ConcreteSyntaxTree__new(size_t capacity)
+{
+    ConcreteSyntaxTree *tree = calloc(1, sizeof(ConcreteSyntaxTree));
+
+    if (tree == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the concrete syntax tree\n");
+        return NULL;
+    }
+
+    if (sConcreteSyntaxTree__resize(tree, capacity == 0 ? DEFAULT_CAPACITY : capacity) <=
+        CCB_ERROR)
+    {
+        ConcreteSyntaxTree__del(tree);
+        return NULL;
+    }
+
+    return tree;
+}
+
+int8_t ConcreteSyntaxTree__reserve(ConcreteSyntaxTree *self)
+{
+    if (self->numOfNodes < self->capacity)
+    {
+        return CCB_SUCCESS;
+    }
+
+    return sConcreteSyntaxTree__resize(self, 2 * self->capacity);
+}
+
+void ConcreteSyntaxTree__clear(ConcreteSyntaxTree *self)
+{
+    self->numOfNodes = 0;
+}
+
+void ConcreteSyntaxTree__del(ConcreteSyntaxTree *self)
+{
+    free(self->productions);
+    free(self->terminals);
+    free(self->parents);
+    free(self->firstChildren);
+    free(self->nextSiblings);
+    free(self->tokenStarts);
+    free(self->tokenEnds);
+    free(self);
+}
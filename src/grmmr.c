@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <ccabral/_grmmr.h>
+#include <ccabral/_prdcprsntble.h>
+#include <ccabral/_prdstble.h>
+#include <ccabral/constants.h>
+#include <ccabral/grmmr.h>
+
+Grammar *Grammar__new(ProductionsHashMap *productions, uint8_t k)
+{
+    Grammar *grammar = calloc(1, sizeof(Grammar));
+
+    if (grammar == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the grammar\n");
+        return NULL;
+    }
+
+    grammar->prdcPrsnTble = PrdcPrsnTble__new(productions, k);
+
+    if (grammar->prdcPrsnTble == NULL)
+    {
+        fprintf(stderr, "Failed to create the predictive parsing table\n");
+        free(grammar);
+        return NULL;
+    }
+
+    grammar->productionsTable = ProductionsTable__new(productions);
+
+    if (grammar->productionsTable == NULL)
+    {
+        fprintf(stderr, "Failed to create the productions table\n");
+        PrdcPrsnTble__del(grammar->prdcPrsnTble);
+        free(grammar);
+        return NULL;
+    }
+
+    return grammar;
+}
+
+Grammar *Grammar__newFromTable(ProductionsHashMap *productions, const char *tablePath)
+{
+    Grammar *grammar = calloc(1, sizeof(Grammar));
+
+    if (grammar == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the grammar\n");
+        return NULL;
+    }
+
+    grammar->productionsTable = ProductionsTable__new(productions);
+
+    if (grammar->productionsTable == NULL)
+    {
+        fprintf(stderr, "Failed to create the productions table\n");
+        free(grammar);
+        return NULL;
+    }
+
+    grammar->prdcPrsnTble = PrdcPrsnTble__load(
+        tablePath,
+        ProductionsTable__hash(grammar->productionsTable),
+        ProductionsTable__getNumOfNonterminals(grammar->productionsTable),
+        grammar->productionsTable->numOfProductions);
+
+    if (grammar->prdcPrsnTble == NULL)
+    {
+        fprintf(stderr, "Failed to load the predictive parsing table\n");
+        ProductionsTable__del(grammar->productionsTable);
+        free(grammar);
+        return NULL;
+    }
+
+    return grammar;
+}
+
+size_t Grammar__getNumOfNonterminals(const Grammar *self)
+{
+    return self->prdcPrsnTble->numOfNonterminals;
+}
+
+size_t Grammar__getNumOfTerminals(const Grammar *self)
+{
+    return self->prdcPrsnTble->numOfTerminals;
+}
+
+size_t Grammar__getNumOfProductions(const Grammar *self)
+{
+    return self->productionsTable->numOfProductions;
+}
+
+void Grammar__del(Grammar *self)
+{
+    PrdcPrsnTble__del(self->prdcPrsnTble);
+    ProductionsTable__del(self->productionsTable);
+    free(self);
+}
@@ -1,171 +1,685 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
+#include <string.h>
+#include <unistd.h>
+#include <ccabral/_cst.h>
+#include <ccabral/_grmmr.h>
+#include <ccabral/_lggr.h>
+#include <ccabral/_lkahd.h>
 #include <ccabral/_prdcdata.h>
 #include <ccabral/_prdcprsntble.h>
+#include <ccabral/_prdstble.h>
 #include <ccabral/_prsrstck.h>
+#include <ccabral/_sttcprsr.h>
 #include <ccabral/types.h>
 #include <ccabral/constants.h>
 #include <ccabral/parser.h>
 
 typedef struct Parser
 {
-    ProductionsHashMap *productions;
     PrdcPrsnTble *prdcPrsnTble;
+    ProductionsTable *productionsTable;
     RunRuleActionCallback runRuleAction;
+    RunArenaRuleActionCallback runArenaRuleAction;
     uint8_t k;
+
+    /* Hooks of each production, or `NULL` if the parser has none, and whether any of them runs
+    on exit */
+    ProductionActions *productionActions;
+    bool hasExitActions;
+
+    /* Hook run on every matched terminal, or `NULL` */
+    TokenActionCallback runTokenAction;
+
+    /* Counters of the parses run through the `Parser__` functions instead of a context of the
+    caller, only accessed atomically since those parses may run in several threads at once.
+    Nothing else in the parser changes after it is created */
+    ParserStats stats;
+
+    /* Grammar holding `prdcPrsnTble` and `productionsTable`, freed with the parser, or `NULL`
+    when the tables belong to the caller */
+    Grammar *ownedGrammar;
 } Parser;
 
-Parser *Parser__new(ProductionsHashMap *productions,
-                    RunRuleActionCallback runRuleAction,
-                    uint8_t k)
+#ifdef CCB_ENABLE_STATS
+#define STATS_ADD(owner, counter, value) ((owner)->stats.counter += (value))
+#define STATS_MAX(owner, counter, value)      \
+    do                                        \
+    {                                         \
+        if ((value) > (owner)->stats.counter) \
+        {                                     \
+            (owner)->stats.counter = (value); \
+        }                                     \
+    } while (0)
+#else
+#define STATS_ADD(owner, counter, value) ((void)0)
+#define STATS_MAX(owner, counter, value) ((void)0)
+#endif
+
+/* Creates a parser of `grammar` that frees it when deleted, or frees it right away on failure */
+static Parser *sParser__newOwningGrammar(Grammar *grammar, RunRuleActionCallback runRuleAction)
 {
-    Parser *parser = malloc(sizeof(Parser));
+    if (grammar == NULL)
+    {
+        return NULL;
+    }
+
+    Parser *parser = Parser__newFromGrammar(grammar, runRuleAction);
 
     if (parser == NULL)
     {
+        Grammar__del(grammar);
         return NULL;
     }
 
-    parser->productions = productions;
-    parser->runRuleAction = runRuleAction;
-    parser->k = k;
+    parser->ownedGrammar = grammar;
+
+    return parser;
+}
+
+Parser *Parser__new(ProductionsHashMap *productions,
+                    RunRuleActionCallback runRuleAction,
+                    uint8_t k)
+{
+    return sParser__newOwningGrammar(Grammar__new(productions, k), runRuleAction);
+}
+
+Parser *Parser__newFromTable(ProductionsHashMap *productions,
+                             RunRuleActionCallback runRuleAction,
+                             const char *tablePath)
+{
+    return sParser__newOwningGrammar(
+        Grammar__newFromTable(productions, tablePath),
+        runRuleAction);
+}
 
-    parser->prdcPrsnTble = PrdcPrsnTble__new(parser->productions, k);
+Parser *Parser__newFromTables(const PrdcPrsnTble *prdcPrsnTble,
+                              const ProductionsTable *productionsTable,
+                              RunRuleActionCallback runRuleAction)
+{
+    Parser *parser = calloc(1, sizeof(Parser));
 
-    if (parser->prdcPrsnTble == NULL)
+    if (parser == NULL)
     {
-        fprintf(stderr, "Failed to create the predictive parsing table\n");
-        free(parser);
+        fprintf(stderr, "Failed to allocate memory for the parser\n");
         return NULL;
     }
 
+    /* The tables are only read, so the `const` can be dropped */
+    parser->prdcPrsnTble = (PrdcPrsnTble *)prdcPrsnTble;
+    parser->productionsTable = (ProductionsTable *)productionsTable;
+    parser->runRuleAction = runRuleAction;
+    parser->k = prdcPrsnTble->k;
+
     return parser;
 }
 
-static int8_t sUpdateLookahead(
-    TokenQueue *input,
-    CCB_terminal_t *lookahead,
-    uint8_t k)
+Parser *Parser__newFromGrammar(const Grammar *grammar, RunRuleActionCallback runRuleAction)
+{
+    return Parser__newFromTables(grammar->prdcPrsnTble, grammar->productionsTable, runRuleAction);
+}
+
+void Parser__setArenaRuleAction(Parser *self, RunArenaRuleActionCallback runArenaRuleAction)
+{
+    free(self->productionActions);
+    self->productionActions = NULL;
+    self->hasExitActions = false;
+    self->runRuleAction = NULL;
+    self->runArenaRuleAction = runArenaRuleAction;
+}
+
+int8_t Parser__setProductionActions(Parser *self,
+                                    const ProductionActions *actions,
+                                    size_t numOfActions)
 {
-    const char *loggerName = "ParserStack__push";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
+    size_t numOfProductions = self->productionsTable->numOfProductions;
 
-    if (logger == NULL)
+    if (numOfActions > numOfProductions)
     {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n", loggerName);
+        fprintf(stderr,
+                "Got %zu production actions for %zu productions\n",
+                numOfActions,
+                numOfProductions);
+        return CCB_ERROR;
+    }
+
+    free(self->productionActions);
+    self->productionActions = NULL;
+    self->hasExitActions = false;
 
-        return false;
+    if (actions == NULL)
+    {
+        return CCB_SUCCESS;
     }
 
-    for (uint8_t i = 0; i < k - 1; i++)
+    self->productionActions = calloc(numOfProductions, sizeof(ProductionActions));
+
+    if (self->productionActions == NULL)
     {
-        lookahead[i] = lookahead[i + 1];
+        fprintf(stderr, "Failed to allocate memory for the production actions\n");
+        return CCB_ERROR;
     }
 
-    if (TokenQueue__dequeue(input, &lookahead[k - 1]) == CCB_ERROR)
+    memcpy(self->productionActions, actions, numOfActions * sizeof(ProductionActions));
+
+    for (size_t production = 0; production < numOfActions; production++)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to dequeue token for lookahead",
-            37);
-        lookahead[k - 1] = CCB_END_OF_TEXT_TR;
+        self->hasExitActions = self->hasExitActions || actions[production].onExit != NULL;
     }
 
-    ssize_t lookaheadStrLen = 1       // (
-                              + k * 8 // TK%d,
-                              + 1     // )
-                              + 1;    // Null terminator
-    ssize_t currLkahStrLen = lookaheadStrLen;
-    char *lookaheadStr = calloc(lookaheadStrLen, sizeof(char));
+    self->runRuleAction = NULL;
+    self->runArenaRuleAction = NULL;
+
+    return CCB_SUCCESS;
+}
+
+void Parser__setTokenAction(Parser *self, TokenActionCallback runTokenAction)
+{
+    self->runTokenAction = runTokenAction;
+}
+
+int8_t Parser__saveTable(const Parser *self, const char *tablePath)
+{
+    return PrdcPrsnTble__save(
+        self->prdcPrsnTble,
+        ProductionsTable__hash(self->productionsTable),
+        tablePath);
+}
+
+#define SOURCE_BUFFER_SIZE 256
+#define PARSE_SUSPENDED 1
+
+/* Lookahead pulled from a `TokenSource` into a circular window, reading the source in batches
+of up to `SOURCE_BUFFER_SIZE` tokens */
+typedef struct SourceInput
+{
+    TokenSource *source;
+    CCB_terminal_t buffer[SOURCE_BUFFER_SIZE];
+    size_t bufferSize;
+    size_t bufferPosition;
+    size_t numOfReadTokens;
+    bool isExhausted;
+    Lookahead lookahead;
+} SourceInput;
+
+/* Lookahead read in place from a caller-owned array of tokens */
+typedef struct SpanInput
+{
+    const CCB_terminal_t *tokens;
+    size_t numOfTokens;
+    size_t position;
+
+    /* Copy of the last tokens of the span padded with `k` end of texts, used once fewer than
+    `k` tokens are left in `tokens` */
+    CCB_terminal_t *tail;
+    size_t tailStart;
+    uint8_t k;
+} SpanInput;
+
+/* Consumes the first token of the lookahead and points `lookaheadPtr` to the updated one */
+typedef int8_t (*UpdateLookaheadCallback)(void *input, const CCB_terminal_t **lookaheadPtr);
 
-    snprintf(lookaheadStr, currLkahStrLen--, "(");
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+static void sLogLookahead(const CCB_terminal_t *lookahead, uint8_t k)
+{
+    /* "TK" and ", " around the 10 digits of the largest 32-bit id */
+    const size_t MAX_TOKEN_LENGTH = sizeof("TK, ") - 1 + 10;
+    size_t lookaheadStrLen = 1                      // (
+                             + k * MAX_TOKEN_LENGTH // TK%lu,
+                             + 1                    // )
+                             + 1;                   // Null terminator
+    char lookaheadStr[lookaheadStrLen];
+    size_t offset = snprintf(lookaheadStr, lookaheadStrLen, "(");
 
     for (uint8_t i = 0; i < k; i++)
     {
-        char *currTkStr = calloc(8, sizeof(char));
-
-        snprintf(currTkStr, 8, "TK%d, ", lookahead[i]);
-        strncat(lookaheadStr, currTkStr, currLkahStrLen);
-        currLkahStrLen -= 8;
+        offset += snprintf(
+            lookaheadStr + offset,
+            lookaheadStrLen - offset,
+            i + 1 < k ? "TK%lu, " : "TK%lu",
+            (unsigned long)lookahead[i]);
     }
 
-    strncat(lookaheadStr, ")", currLkahStrLen--);
+    snprintf(lookaheadStr + offset, lookaheadStrLen - offset, ")");
 
-    ClnLogger__log(
-        logger,
-        CLN_DEBUG_LL,
+    CCB_LOG_DEBUG(
+        CCB_PARSER_LM,
         "Updated lookahead: %s",
         19 + lookaheadStrLen,
         lookaheadStr);
+}
+#endif
+
+/* Writes the next token of the source into `tokenPtr`, or returns `false` once it has ended */
+static bool sSourceInput__next(SourceInput *self, CCB_terminal_t *tokenPtr)
+{
+    if (self->bufferPosition == self->bufferSize)
+    {
+        if (self->isExhausted)
+        {
+            return false;
+        }
+
+        self->bufferSize = self->source->read(
+            self->source->context,
+            self->buffer,
+            SOURCE_BUFFER_SIZE);
+        self->bufferPosition = 0;
+        self->numOfReadTokens += self->bufferSize;
+
+        if (self->bufferSize == 0)
+        {
+            CCB_LOG_DEBUG(
+                CCB_PARSER_LM,
+                "No token left to read for lookahead",
+                35);
+            self->isExhausted = true;
+            return false;
+        }
+    }
+
+    *tokenPtr = self->buffer[self->bufferPosition++];
+    return true;
+}
+
+static int8_t sUpdateLookahead(void *rawInput, const CCB_terminal_t **lookaheadPtr)
+{
+    SourceInput *input = rawInput;
+    CCB_terminal_t token;
+
+    if (!sSourceInput__next(input, &token))
+    {
+        token = CCB_END_OF_TEXT_TR;
+    }
+
+    Lookahead__push(&input->lookahead, token);
+    *lookaheadPtr = Lookahead__window(&input->lookahead);
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+    sLogLookahead(*lookaheadPtr, input->lookahead.k);
+#endif
 
-    free(lookaheadStr);
-    ClnLogger__del(logger);
     return CCB_SUCCESS;
 }
 
-TreeNode *Parser__parse(Parser *self, TokenQueue *input)
+static int8_t sUpdateSpanLookahead(void *rawInput, const CCB_terminal_t **lookaheadPtr)
+{
+    SpanInput *input = rawInput;
+
+    if (input->position < input->numOfTokens)
+    {
+        input->position++;
+    }
+
+    if (input->position + input->k <= input->numOfTokens)
+    {
+        *lookaheadPtr = &input->tokens[input->position];
+    }
+    else
+    {
+        *lookaheadPtr = &input->tail[input->position - input->tailStart];
+    }
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+    sLogLookahead(*lookaheadPtr, input->k);
+#endif
+
+    return CCB_SUCCESS;
+}
+
+/* Production whose exit is due once the parser stack is back to `stackSize` grammars, which is
+when the grammars of its right hand side are all consumed */
+typedef struct ProductionExit
+{
+    CCB_production_t production;
+    size_t stackSize;
+
+    /* Node of the production in the syntax tree, and its last child so far */
+    size_t node;
+    size_t lastChild;
+} ProductionExit;
+
+/* Mutable state of the parses of a parser. It survives between calls, so a parse can be
+suspended when the input runs out and resumed when more of it arrives, and between parses, so
+the stack keeps its memory */
+typedef struct ParseContext
+{
+    const Parser *parser;
+    ParserStack *stack;
+    GrammarData stackTop;
+    TreeNode *tree;
+
+    /* The next `k` tokens of the input */
+    const CCB_terminal_t *lookahead;
+    void *input;
+    UpdateLookaheadCallback updateLookahead;
+
+    /* Number of tokens at the end of `lookahead` that were not received yet. It is always 0
+    unless the input is pushed with `Parser__feed` */
+    uint8_t numOfMissingTokens;
+
+    /* Lookahead window of the source and push modes, over a buffer of `2 * k` tokens */
+    Lookahead window;
+
+    /* Pending chunk of the push mode */
+    const CCB_terminal_t *chunk;
+    size_t chunkSize;
+    size_t chunkPosition;
+    size_t numOfFedTokens;
+    bool isInputEnded;
+    bool hasFailed;
+
+    ParserStats stats;
+
+    /* Arena the tree is built in, which owns it, or `NULL` if it is built with `malloc` */
+    ParseArena *arena;
+
+    /* Listener of the parse events, or `NULL` */
+    const ParseListener *listener;
+
+    /* Syntax tree filled by the parse, or `NULL` */
+    ConcreteSyntaxTree *syntaxTree;
+
+    /* Whether the parse tracks the productions it enters and exits, for the listener, the
+    syntax tree or the exit hooks of the parser */
+    bool tracksProductions;
+
+    /* Passed to the production and token actions of the parser */
+    void *actionContext;
+
+    /* Records of the parse of token records, indexed by the position of the tokens, or `NULL` */
+    const TokenRecord *records;
+
+    /* Productions entered and not exited yet, innermost last, while they are tracked */
+    ProductionExit *exits;
+    size_t numOfExits;
+    size_t exitsCapacity;
+
+    /* Terminals matched so far by the parse */
+    size_t numOfMatchedTokens;
+
+    /* Result of the last parse that ended */
+    int8_t status;
+
+    /* Parser whose counters the ones of the context are added into when its parse finishes,
+    for the contexts created by `Parser__begin` */
+    Parser *statsParser;
+} ParseContext;
+
+static int8_t sParseContext__init(ParseContext *self,
+                                  const Parser *parser,
+                                  CCB_terminal_t *windowBuffer)
+{
+    memset(self, 0x0, sizeof(ParseContext));
+
+    self->parser = parser;
+    self->status = CCB_ERROR;
+    self->stack = ParserStack__new();
+
+    if (self->stack == NULL)
+    {
+        fprintf(stderr, "Failed to create parser stack\n");
+        return CCB_ERROR;
+    }
+
+    Lookahead__init(&self->window, windowBuffer, parser->k);
+
+    return CCB_SUCCESS;
+}
+
+/* Frees what `sParseContext__init` and the parses allocated, but neither the context nor its
+window */
+static void sParseContext__deinit(ParseContext *self)
 {
-    CCB_terminal_t lookahead[self->k];
-    memset(lookahead, CCB_END_OF_TEXT_TR, self->k * sizeof(CCB_terminal_t));
+    ParserStack__del(self->stack);
+    free(self->exits);
+}
+
+/* Starts a new parse over the stack and window of the previous one, abandoning it if it did
+not finish */
+static void sParseContext__start(ParseContext *self,
+                                 void *input,
+                                 UpdateLookaheadCallback updateLookahead,
+                                 const CCB_terminal_t *lookahead)
+{
+    if (self->tree != NULL && self->arena == NULL)
+    {
+        TreeNode__del(self->tree);
+    }
+
+    self->tree = NULL;
+    ParserStack__reset(self->stack);
+    self->stackTop.id = CCB_START_NT;
+    self->stackTop.type = CCB_NONTERMINAL_GT;
+    self->lookahead = lookahead;
+    self->input = input;
+    self->updateLookahead = updateLookahead;
+    self->numOfMissingTokens = 0;
+    self->chunk = NULL;
+    self->chunkSize = 0;
+    self->chunkPosition = 0;
+    self->numOfFedTokens = 0;
+    self->isInputEnded = false;
+    self->hasFailed = false;
+    self->numOfExits = 0;
+    self->numOfMatchedTokens = 0;
+    self->tracksProductions = self->listener != NULL ||
+                              self->syntaxTree != NULL ||
+                              self->parser->hasExitActions;
+
+    if (self->syntaxTree != NULL)
+    {
+        ConcreteSyntaxTree__clear(self->syntaxTree);
+    }
+}
+
+/* Sends the entry event of `production`, adds its node to the syntax tree, and remembers it
+until its exit, due once the parser stack is back to `stackSize` grammars */
+static int8_t sParseContext__enterProduction(ParseContext *self,
+                                             CCB_production_t production,
+                                             size_t stackSize)
+{
+    const ParseListener *listener = self->listener;
 
-    TreeNode *tree = NULL;
+    if (listener != NULL &&
+        listener->onEnterProduction != NULL &&
+        listener->onEnterProduction(listener->context, production) <= CCB_ERROR)
+    {
+        fprintf(stderr, "Parse listener stopped the parse on a production entry\n");
+        return CCB_ERROR;
+    }
 
-    for (uint8_t i = 0; i < self->k; i++)
+    if (self->numOfExits == self->exitsCapacity)
     {
-        if (TokenQueue__dequeue(input, &lookahead[i]) == CCB_ERROR)
+        size_t newCapacity = self->exitsCapacity == 0 ? 64 : 2 * self->exitsCapacity;
+        ProductionExit *newExits = realloc(self->exits, newCapacity * sizeof(ProductionExit));
+
+        if (newExits == NULL)
         {
-            fprintf(stderr, "Failed to initialize lookahead[%d]\n", i);
-            return NULL;
+            fprintf(stderr, "Failed to grow the production exits to %zu\n", newCapacity);
+            return CCB_ERROR;
         }
+
+        self->exits = newExits;
+        self->exitsCapacity = newCapacity;
+
+#ifdef CCB_ENABLE_STATS
+        self->stats.numOfAllocations++;
+#endif
     }
 
-    ParserStack *stack = ParserStack__new();
+    ProductionExit *entry = &self->exits[self->numOfExits];
+    entry->production = production;
+    entry->stackSize = stackSize;
+    entry->node = CCB_NO_NODE;
+    entry->lastChild = CCB_NO_NODE;
 
-    if (stack == NULL)
+    if (self->syntaxTree != NULL)
     {
-        fprintf(stderr, "Failed to create parser stack\n");
-        return NULL;
+        ProductionExit *parent = self->numOfExits > 0 ? entry - 1 : NULL;
+        size_t parentNode = parent != NULL ? parent->node : CCB_NO_NODE;
+        size_t previousSibling = parent != NULL ? parent->lastChild : CCB_NO_NODE;
+
+        entry->node = ConcreteSyntaxTree__addNode(self->syntaxTree,
+                                                  production,
+                                                  CCB_EMPTY_STRING_TR,
+                                                  parentNode,
+                                                  previousSibling,
+                                                  self->numOfMatchedTokens);
+
+        if (entry->node == CCB_NO_NODE)
+        {
+            return CCB_ERROR;
+        }
+
+        if (parent != NULL)
+        {
+            parent->lastChild = entry->node;
+        }
+    }
+
+    self->numOfExits++;
+
+    return CCB_SUCCESS;
+}
+
+/* Runs the token action on the match of `terminal`, sends its event and adds its node to the
+syntax tree */
+static int8_t sParseContext__matchToken(ParseContext *self, CCB_terminal_t terminal)
+{
+    const ParseListener *listener = self->listener;
+    TokenActionCallback runTokenAction = self->parser->runTokenAction;
+
+    if (runTokenAction != NULL)
+    {
+        TokenRecord token = {.terminal = terminal};
+        const TokenRecord *record =
+            self->records != NULL ? &self->records[self->numOfMatchedTokens] : &token;
+
+        if (runTokenAction(&self->tree, record, self->actionContext) <= CCB_ERROR)
+        {
+            fprintf(stderr, "Token action of terminal %zu failed\n", (size_t)terminal);
+            return CCB_ERROR;
+        }
     }
 
-    if (ParserStack__push(stack, CCB_START_NT, CCB_NONTERMINAL_GT) == CCB_ERROR)
+    if (listener != NULL &&
+        listener->onToken != NULL &&
+        listener->onToken(listener->context, terminal, self->numOfMatchedTokens) <= CCB_ERROR)
     {
-        fprintf(stderr, "Failed to push start nonterminal\n");
-        Stack__del(stack);
-        return NULL;
+        fprintf(stderr, "Parse listener stopped the parse on a token\n");
+        return CCB_ERROR;
+    }
+
+    if (self->syntaxTree != NULL && self->numOfExits > 0)
+    {
+        ProductionExit *parent = &self->exits[self->numOfExits - 1];
+        size_t node = ConcreteSyntaxTree__addNode(self->syntaxTree,
+                                                  CCB_ERROR_PR,
+                                                  terminal,
+                                                  parent->node,
+                                                  parent->lastChild,
+                                                  self->numOfMatchedTokens);
+
+        if (node == CCB_NO_NODE)
+        {
+            return CCB_ERROR;
+        }
+
+        self->syntaxTree->tokenEnds[node]++;
+        parent->lastChild = node;
     }
 
-    GrammarData *stackTop = NULL;
+    self->numOfMatchedTokens++;
+
+    return CCB_SUCCESS;
+}
+
+/* Runs the exit hooks and sends the exit events of the productions whose right hand sides are
+consumed, and closes their token ranges, called before the parser pops the grammar below them */
+static int8_t sParseContext__exitProductions(ParseContext *self)
+{
+    const ParseListener *listener = self->listener;
+    const ProductionActions *productionActions = self->parser->productionActions;
 
-    if (ParserStack__pop(stack, &stackTop) == CCB_ERROR)
+    while (self->numOfExits > 0 &&
+           self->exits[self->numOfExits - 1].stackSize >= self->stack->stackSize)
     {
-        fprintf(stderr, "Failed to pop stack\n");
-        Stack__del(stack);
-        return NULL;
+        self->numOfExits--;
+        CCB_production_t production = self->exits[self->numOfExits].production;
+
+        if (self->syntaxTree != NULL)
+        {
+            self->syntaxTree->tokenEnds[self->exits[self->numOfExits].node] =
+                self->numOfMatchedTokens;
+        }
+
+        if (productionActions != NULL &&
+            productionActions[production].onExit != NULL &&
+            productionActions[production].onExit(
+                &self->tree,
+                production,
+                self->actionContext) <= CCB_ERROR)
+        {
+            fprintf(stderr, "Exit action of production %zu failed\n", (size_t)production);
+            return CCB_ERROR;
+        }
+
+        if (listener != NULL &&
+            listener->onExitProduction != NULL &&
+            listener->onExitProduction(listener->context, production) <= CCB_ERROR)
+        {
+            fprintf(stderr, "Parse listener stopped the parse on a production exit\n");
+            return CCB_ERROR;
+        }
     }
 
+    return CCB_SUCCESS;
+}
+
+/* Runs the parse until it ends, fails, or needs tokens that were not received yet. Returns
+`CCB_SUCCESS`, `CCB_ERROR` or `PARSE_SUSPENDED` respectively */
+static int8_t sParseContext__run(ParseContext *self)
+{
+    const Parser *parser = self->parser;
+    bool tracksProductions = self->tracksProductions;
+    bool tracksTokens = tracksProductions || parser->runTokenAction != NULL;
+    GrammarData stackTop = self->stackTop;
+    const CCB_terminal_t *lookahead = self->lookahead;
     CCB_production_t foundRule = -1;
 
-    while (!GrammarData__isEndOfText(stackTop))
+    while (!GrammarData__isEndOfText(&stackTop))
     {
-        if (stackTop->type == CCB_TERMINAL_GT)
+        if (self->numOfMissingTokens > 0)
+        {
+            self->stackTop = stackTop;
+            self->lookahead = lookahead;
+            return PARSE_SUSPENDED;
+        }
+
+        if (stackTop.type == CCB_TERMINAL_GT)
         {
-            if (stackTop->id == lookahead[0])
+            if (stackTop.id == lookahead[0])
             {
-                if (sUpdateLookahead(input, lookahead, self->k) <= CCB_ERROR)
+                STATS_ADD(self, numOfMatches, 1);
+
+                if (tracksTokens && sParseContext__matchToken(self, stackTop.id) <= CCB_ERROR)
+                {
+                    return CCB_ERROR;
+                }
+
+                if (self->updateLookahead(self->input, &lookahead) <= CCB_ERROR)
                 {
-                    char *grammarDataStr = GrammarData__str(stackTop);
+                    char *grammarDataStr = GrammarData__str(&stackTop);
 
                     if (grammarDataStr == NULL)
                     {
                         fprintf(stderr, "Failed to strigify top of stack\n");
-                        free(stackTop);
-                        Stack__del(stack);
-                        return NULL;
+                        return CCB_ERROR;
                     }
 
                     fprintf(
@@ -174,205 +688,888 @@ TreeNode *Parser__parse(Parser *self, TokenQueue *input)
                         grammarDataStr);
 
                     free(grammarDataStr);
-                    free(stackTop);
-                    Stack__del(stack);
-                    return NULL;
+                    return CCB_ERROR;
                 }
 
-                free(stackTop);
-                if (ParserStack__pop(stack, &stackTop) == CCB_ERROR)
+                if (tracksProductions && sParseContext__exitProductions(self) <= CCB_ERROR)
+                {
+                    return CCB_ERROR;
+                }
+
+                if (ParserStack__pop(self->stack, &stackTop) == CCB_ERROR)
                 {
                     fprintf(stderr, "Failed to pop the parser stack\n");
-                    free(stackTop);
-                    Stack__del(stack);
-                    return NULL;
+                    return CCB_ERROR;
                 }
             }
             else
             {
-                fprintf(stderr, "Unexpected token %d\n", lookahead[0]);
-                free(stackTop);
-                Stack__del(stack);
-                return NULL;
+                fprintf(stderr, "Unexpected token %lu\n", (unsigned long)lookahead[0]);
+                return CCB_ERROR;
             }
 
             continue;
         }
 
-        for (
-            int16_t lookaheadIdx = self->k;
-            lookaheadIdx > 0;
-            lookaheadIdx--)
+        uint8_t prefixLength = 1;
+
+        if (parser->k == 1)
+        {
+            foundRule = PrdcPrsnTble__getLL1Item(
+                parser->prdcPrsnTble,
+                stackTop.id,
+                lookahead[0]);
+        }
+        else
         {
-            CCB_terminal_t lkAheadSubset[self->k];
+            foundRule = PrdcPrsnTble__predict(
+                parser->prdcPrsnTble,
+                stackTop.id,
+                lookahead,
+                &prefixLength);
+        }
 
-            for (
-                int16_t firstSubsetIx = 0;
-                firstSubsetIx < self->k;
-                firstSubsetIx++)
-            {
-                lkAheadSubset[firstSubsetIx] = lookahead[firstSubsetIx];
-            }
+        if (foundRule < 0)
+        {
+            fprintf(stderr,
+                    "Unexpected token TK%lu for nonterminal NT%lu. The available options are:\n",
+                    (unsigned long)lookahead[0],
+                    (unsigned long)stackTop.id);
 
-            for (
-                int16_t sndSubsetIx = lookaheadIdx;
-                sndSubsetIx < self->k;
-                sndSubsetIx++)
-            {
-                lkAheadSubset[sndSubsetIx] = CCB_EMPTY_STRING_TR;
-            }
+            PrdcPrsnTble__printOptions(parser->prdcPrsnTble, stackTop.id, stderr);
 
-            if (PrdcPrsnTble__getItem(
-                    self->prdcPrsnTble,
-                    stackTop->id,
-                    lkAheadSubset,
-                    self->k,
-                    &foundRule) <= CCB_ERROR_PR)
-            {
-                fprintf(stderr, "Failed to lookup the predictive parsing table");
+            return CCB_ERROR;
+        }
 
-                free(stackTop);
-                Stack__del(stack);
-                return NULL;
-            }
+        STATS_ADD(self, numOfExpansions, 1);
+        STATS_ADD(self,
+                  numOfLookups[prefixLength < CCB_STATS_MAX_PREFIX_LENGTH
+                                   ? prefixLength - 1
+                                   : CCB_STATS_MAX_PREFIX_LENGTH - 1],
+                  1);
 
-            if (foundRule >= 0)
-            {
-                break;
-            }
-            else
+        if (parser->runRuleAction != NULL)
+        {
+            if (parser->runRuleAction(&self->tree, foundRule) <= CCB_ERROR)
             {
-                fprintf(stderr, "No production found for the sequence:\n\t(");
-
-                for (
-                    int16_t lkAheadSubsetIx = 0;
-                    lkAheadSubsetIx < self->k;
-                    lkAheadSubsetIx++)
-                {
-                    fprintf(stderr, "T%d, ", lkAheadSubset[lkAheadSubsetIx]);
-                }
-
-                fprintf(stderr, ")\n");
+                fprintf(stderr, "Rule action of production %zu failed\n", (size_t)foundRule);
+                return CCB_ERROR;
             }
         }
-
-        if (foundRule < 0)
+        else if (parser->runArenaRuleAction != NULL)
         {
-            fprintf(stderr,
-                    "Unexpected token TK%d for nonterminal NT%d. The available options are:\n",
-                    lookahead[0],
-                    stackTop->id);
-
-            HashMapEntry **entries = HashMap__getEntries(self->prdcPrsnTble[stackTop->id]);
-
-            for (
-                ssize_t entryIx = 0;
-                entryIx < self->prdcPrsnTble[stackTop->id]->nentries;
-                entryIx++)
+            if (parser->runArenaRuleAction(&self->tree, foundRule, self->arena) <= CCB_ERROR)
             {
-                CCB_terminal_t *currKSeq = entries[entryIx]->value;
-
-                fprintf(stderr, "\t(");
-
-                for (
-                    int16_t kSeqIx = 0;
-                    kSeqIx < self->k;
-                    kSeqIx++)
-                {
-                    fprintf(stderr, "T%d, ", currKSeq[kSeqIx]);
-                }
-
-                fprintf(stderr, ")\n");
+                fprintf(stderr, "Rule action of production %zu failed\n", (size_t)foundRule);
+                return CCB_ERROR;
             }
-
-            free(stackTop);
-            Stack__del(stack);
-            return NULL;
         }
-
-        if (self->runRuleAction != NULL)
+        else if (parser->productionActions != NULL &&
+                 parser->productionActions[foundRule].onEnter != NULL &&
+                 parser->productionActions[foundRule].onEnter(
+                     &self->tree,
+                     foundRule,
+                     self->actionContext) <= CCB_ERROR)
         {
-            self->runRuleAction(&tree, foundRule);
+            fprintf(stderr, "Enter action of production %zu failed\n", (size_t)foundRule);
+            return CCB_ERROR;
         }
 
-        ProductionData *productionData;
-
-        if (ProductionsHashMap__getProdDataFromNonterminalNRuleId(
-                self->productions,
-                stackTop->id,
-                foundRule,
-                &productionData) <= CCB_ERROR)
+        if (tracksProductions &&
+            sParseContext__enterProduction(self, foundRule, self->stack->stackSize) <= CCB_ERROR)
         {
-            fprintf(
-                stderr,
-                "Failed to get production data for rule P%d",
-                foundRule);
-            return NULL;
+            return CCB_ERROR;
         }
 
-        DoublyLinkedListNode *currentGrammarNode = productionData->rightHandTail;
-        GrammarData *currentGrammar = currentGrammarNode->value;
+        uint8_t rightHandLength;
+        const GrammarData *rightHand = ProductionsTable__getRightHand(
+            parser->productionsTable,
+            foundRule,
+            &rightHandLength);
 
-        if (!GrammarData__isEmptyString(currentGrammar))
+        if (ParserStack__pushMany(self->stack, rightHand, rightHandLength) == CCB_ERROR)
         {
-            if (ParserStack__push(
-                    stack,
-                    currentGrammar->id,
-                    currentGrammar->type) == CCB_ERROR)
-            {
-                fprintf(stderr, "Failed to push the grammar to stack\n");
-                free(stackTop);
-                Stack__del(stack);
-                return NULL;
-            }
+            fprintf(stderr, "Failed to push the grammar to stack\n");
+            return CCB_ERROR;
+        }
 
-            while (currentGrammarNode->prev != NULL)
-            {
-                currentGrammarNode = currentGrammarNode->prev;
-                currentGrammar = currentGrammarNode->value;
+        STATS_MAX(self, maxStackDepth, self->stack->stackSize);
 
-                if (ParserStack__push(
-                        stack,
-                        currentGrammar->id,
-                        currentGrammar->type) == CCB_ERROR)
-                {
-                    fprintf(stderr, "Failed to push the grammar to stack\n");
-                    free(stackTop);
-                    Stack__del(stack);
-                    return NULL;
-                }
-            }
+        if (tracksProductions && sParseContext__exitProductions(self) <= CCB_ERROR)
+        {
+            return CCB_ERROR;
         }
 
-        free(stackTop);
-        if (ParserStack__pop(stack, &stackTop) == -1)
+        if (ParserStack__pop(self->stack, &stackTop) == CCB_ERROR)
         {
             fprintf(stderr, "Failed to pop the parser stack\n");
-            Stack__del(stack);
-            return NULL;
+            return CCB_ERROR;
         }
     }
 
-    free(stackTop);
+    self->stackTop = stackTop;
+    self->lookahead = lookahead;
 
-    if (lookahead[0] != CCB_END_OF_TEXT_TR)
+    if (self->numOfMissingTokens == parser->k)
     {
-        fprintf(stderr, "Unexpected token %d after parsing completed\n", lookahead[0]);
-        if (tree != NULL)
-        {
-            TreeNode__del(tree);
-        }
-        Stack__del(stack);
-        return NULL;
+        return PARSE_SUSPENDED;
     }
 
-    Stack__del(stack);
-
+    if (lookahead[0] != CCB_END_OF_TEXT_TR)
+    {
+        fprintf(
+            stderr,
+            "Unexpected token %lu after parsing completed\n",
+            (unsigned long)lookahead[0]);
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+/* Hands over the tree built, or frees it and returns `NULL` if `status` is not
+`CCB_SUCCESS` */
+static TreeNode *sParseContext__release(ParseContext *self, int8_t status)
+{
+#ifdef CCB_ENABLE_STATS
+    STATS_ADD(self, numOfAllocations, self->stack->numOfAllocations);
+    self->stack->numOfAllocations = 0;
+#endif
+
+    TreeNode *tree = self->tree;
+    self->tree = NULL;
+    self->status = status == CCB_SUCCESS ? CCB_SUCCESS : CCB_ERROR;
+
+    if (status != CCB_SUCCESS)
+    {
+        /* The nodes of an arena are only released with it */
+        if (tree != NULL && self->arena == NULL)
+        {
+            TreeNode__del(tree);
+        }
+
+        return NULL;
+    }
+
+    return tree;
+}
+
+#ifdef CCB_ENABLE_STATS
+#define PARSER_STATS_ADD(parser, counter, value) \
+    ((void)__atomic_fetch_add(&(parser)->stats.counter, (value), __ATOMIC_RELAXED))
+#define PARSER_STATS_LOAD(parser, counter) \
+    __atomic_load_n(&(parser)->stats.counter, __ATOMIC_RELAXED)
+#define PARSER_STATS_CLEAR(parser, counter) \
+    __atomic_store_n(&(parser)->stats.counter, 0, __ATOMIC_RELAXED)
+
+/* Raises `*counter` to `value` unless another thread raised it higher */
+static void sAtomicMax(size_t *counter, size_t value)
+{
+    size_t current = __atomic_load_n(counter, __ATOMIC_RELAXED);
+
+    while (value > current &&
+           !__atomic_compare_exchange_n(
+               counter, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+#endif
+
+/* Adds the counters of `context` into the ones of the parser */
+static void sParser__addStats(Parser *self, const ParseContext *context)
+{
+#ifdef CCB_ENABLE_STATS
+    const ParserStats *stats = &context->stats;
+
+    PARSER_STATS_ADD(self, numOfExpansions, stats->numOfExpansions);
+    PARSER_STATS_ADD(self, numOfMatches, stats->numOfMatches);
+
+    for (size_t i = 0; i < CCB_STATS_MAX_PREFIX_LENGTH; i++)
+    {
+        PARSER_STATS_ADD(self, numOfLookups[i], stats->numOfLookups[i]);
+    }
+
+    sAtomicMax(&self->stats.maxStackDepth, stats->maxStackDepth);
+    PARSER_STATS_ADD(self, numOfTokens, stats->numOfTokens);
+    PARSER_STATS_ADD(self, numOfAllocations, stats->numOfAllocations);
+#else
+    (void)self;
+    (void)context;
+#endif
+}
+
+ParseContext *ParseContext__new(const Parser *parser)
+{
+    ParseContext *context = malloc(sizeof(ParseContext));
+    CCB_terminal_t *windowBuffer = malloc(2 * parser->k * sizeof(CCB_terminal_t));
+
+    if (context == NULL || windowBuffer == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the parse context\n");
+        free(windowBuffer);
+        free(context);
+        return NULL;
+    }
+
+    if (sParseContext__init(context, parser, windowBuffer) <= CCB_ERROR)
+    {
+        free(windowBuffer);
+        free(context);
+        return NULL;
+    }
+
+    /* The context and its lookahead window */
+    STATS_ADD(context, numOfAllocations, 2);
+
+    return context;
+}
+
+void ParseContext__setArena(ParseContext *self, ParseArena *arena)
+{
+    /* An unfinished parse is abandoned, since its tree belongs to the previous arena */
+    if (self->tree != NULL && self->arena == NULL)
+    {
+        TreeNode__del(self->tree);
+    }
+
+    self->tree = NULL;
+    self->hasFailed = true;
+    self->arena = arena;
+}
+
+void ParseContext__setListener(ParseContext *self, const ParseListener *listener)
+{
+    self->listener = listener;
+    self->hasFailed = true;
+}
+
+void ParseContext__setSyntaxTree(ParseContext *self, ConcreteSyntaxTree *syntaxTree)
+{
+    self->syntaxTree = syntaxTree;
+    self->hasFailed = true;
+}
+
+void ParseContext__setActionContext(ParseContext *self, void *context)
+{
+    self->actionContext = context;
+}
+
+int8_t ParseContext__getStatus(const ParseContext *self)
+{
+    return self->status;
+}
+
+TreeNode *ParseContext__parseSource(ParseContext *self, TokenSource *source)
+{
+    uint8_t k = self->parser->k;
+    SourceInput sourceInput = {.source = source};
+
+    Lookahead__init(&sourceInput.lookahead, self->window.tokens, k);
+
+    for (uint8_t i = 0; i < k; i++)
+    {
+        CCB_terminal_t token;
+
+        if (!sSourceInput__next(&sourceInput, &token))
+        {
+            if (i == 0)
+            {
+                fprintf(stderr, "Failed to initialize lookahead from an empty input\n");
+                return NULL;
+            }
+
+            token = CCB_END_OF_TEXT_TR;
+        }
+
+        Lookahead__push(&sourceInput.lookahead, token);
+    }
+
+    sParseContext__start(
+        self,
+        &sourceInput,
+        sUpdateLookahead,
+        Lookahead__window(&sourceInput.lookahead));
+
+    TreeNode *tree = sParseContext__release(self, sParseContext__run(self));
+
+    STATS_ADD(self, numOfTokens, sourceInput.numOfReadTokens);
+
+    return tree;
+}
+
+/* Token records read as a token source, gathering their terminals into the lookahead window
+while the records themselves stay in place */
+typedef struct RecordsInput
+{
+    const TokenRecord *records;
+    size_t numOfRecords;
+    size_t position;
+} RecordsInput;
+
+static size_t sRecordsInput__read(void *context, CCB_terminal_t *buffer, size_t capacity)
+{
+    RecordsInput *self = context;
+    size_t numOfTokens = self->numOfRecords - self->position;
+
+    if (numOfTokens > capacity)
+    {
+        numOfTokens = capacity;
+    }
+
+    for (size_t i = 0; i < numOfTokens; i++)
+    {
+        buffer[i] = self->records[self->position + i].terminal;
+    }
+
+    self->position += numOfTokens;
+
+    return numOfTokens;
+}
+
+TreeNode *ParseContext__parseRecords(ParseContext *self,
+                                     const TokenRecord *records,
+                                     size_t numOfRecords)
+{
+    RecordsInput recordsInput = {.records = records, .numOfRecords = numOfRecords};
+    TokenSource source = {.read = sRecordsInput__read, .context = &recordsInput};
+
+    self->records = records;
+    TreeNode *tree = ParseContext__parseSource(self, &source);
+    self->records = NULL;
+
+    return tree;
+}
+
+static size_t sTokenQueue__read(void *context, CCB_terminal_t *buffer, size_t capacity)
+{
+    return TokenQueue__dequeueMany(context, buffer, capacity);
+}
+
+TreeNode *ParseContext__parse(ParseContext *self, TokenQueue *input)
+{
+    TokenSource source = {.read = sTokenQueue__read, .context = input};
+
+    return ParseContext__parseSource(self, &source);
+}
+
+TreeNode *ParseContext__parseSpan(ParseContext *self,
+                                  const CCB_terminal_t *tokens,
+                                  size_t numOfTokens)
+{
+    uint8_t k = self->parser->k;
+
+    if (numOfTokens == 0)
+    {
+        fprintf(stderr, "Failed to initialize lookahead from an empty span\n");
+        return NULL;
+    }
+
+    size_t tailStart = numOfTokens >= k ? numOfTokens - k + 1 : 0;
+    size_t tailLength = numOfTokens - tailStart;
+    CCB_terminal_t tail[tailLength + k];
+
+    memcpy(tail, &tokens[tailStart], tailLength * sizeof(CCB_terminal_t));
+
+    /* Terminals may be wider than a byte, so the padding cannot be a `memset` */
+    for (size_t i = tailLength; i < tailLength + k; i++)
+    {
+        tail[i] = CCB_END_OF_TEXT_TR;
+    }
+
+    SpanInput spanInput = {
+        .tokens = tokens,
+        .numOfTokens = numOfTokens,
+        .position = 0,
+        .tail = tail,
+        .tailStart = tailStart,
+        .k = k,
+    };
+
+    sParseContext__start(
+        self,
+        &spanInput,
+        sUpdateSpanLookahead,
+        numOfTokens >= k ? tokens : tail);
+
+    TreeNode *tree = sParseContext__release(self, sParseContext__run(self));
+
+    /* The lookahead reads up to `k` tokens past the last one matched */
+    STATS_ADD(self,
+              numOfTokens,
+              numOfTokens - spanInput.position < k
+                  ? numOfTokens
+                  : spanInput.position + k);
+
+    return tree;
+}
+
+/* Moves tokens of the pending chunk into the missing slots of the push mode window */
+static void sParseContext__fillWindow(ParseContext *self)
+{
+    while (self->numOfMissingTokens > 0 && self->chunkPosition < self->chunkSize)
+    {
+        Lookahead__set(
+            &self->window,
+            self->window.k - self->numOfMissingTokens,
+            self->chunk[self->chunkPosition++]);
+        self->numOfMissingTokens--;
+    }
+}
+
+static int8_t sUpdatePushLookahead(void *rawInput, const CCB_terminal_t **lookaheadPtr)
+{
+    ParseContext *context = rawInput;
+
+    /* The new last token is an end of text until one is received */
+    Lookahead__push(&context->window, CCB_END_OF_TEXT_TR);
+
+    if (!context->isInputEnded)
+    {
+        context->numOfMissingTokens++;
+        sParseContext__fillWindow(context);
+    }
+
+    *lookaheadPtr = Lookahead__window(&context->window);
+
+#if CCB_LOG_LEVEL <= CCB_DEBUG_LL
+    if (context->numOfMissingTokens == 0)
+    {
+        sLogLookahead(*lookaheadPtr, context->window.k);
+    }
+#endif
+
+    return CCB_SUCCESS;
+}
+
+void ParseContext__begin(ParseContext *self)
+{
+    Lookahead__init(&self->window, self->window.tokens, self->parser->k);
+
+    sParseContext__start(self, self, sUpdatePushLookahead, Lookahead__window(&self->window));
+
+    self->numOfMissingTokens = self->parser->k;
+}
+
+int8_t Parser__feed(ParseContext *context,
+                    const CCB_terminal_t *tokens,
+                    size_t numOfTokens)
+{
+    if (context->hasFailed)
+    {
+        return CCB_ERROR;
+    }
+
+    context->chunk = tokens;
+    context->chunkSize = numOfTokens;
+    context->chunkPosition = 0;
+    context->numOfFedTokens += numOfTokens;
+
+    sParseContext__fillWindow(context);
+
+    int8_t status = sParseContext__run(context);
+
+    context->chunk = NULL;
+    context->chunkSize = 0;
+    context->chunkPosition = 0;
+
+    if (status <= CCB_ERROR)
+    {
+        context->hasFailed = true;
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+TreeNode *ParseContext__finish(ParseContext *self)
+{
+    int8_t status = CCB_ERROR;
+
+    if (!self->hasFailed)
+    {
+        if (self->numOfFedTokens == 0)
+        {
+            fprintf(stderr, "Failed to initialize lookahead from an empty input\n");
+        }
+        else
+        {
+            /* The missing tokens already are end of texts */
+            self->isInputEnded = true;
+            self->numOfMissingTokens = 0;
+            status = sParseContext__run(self);
+        }
+    }
+
+    STATS_ADD(self, numOfTokens, self->numOfFedTokens);
+
+    /* A finished parse cannot be fed anymore */
+    self->hasFailed = true;
+
+    return sParseContext__release(self, status);
+}
+
+int8_t ParseContext__getStats(const ParseContext *self, ParserStats *stats)
+{
+#ifdef CCB_ENABLE_STATS
+    *stats = self->stats;
+    return CCB_SUCCESS;
+#else
+    (void)self;
+    memset(stats, 0x0, sizeof(ParserStats));
+    fprintf(stderr, "Failed to get the parse context stats, built without CCB_ENABLE_STATS\n");
+    return CCB_ERROR;
+#endif
+}
+
+void ParseContext__resetStats(ParseContext *self)
+{
+    memset(&self->stats, 0x0, sizeof(ParserStats));
+}
+
+void ParseContext__del(ParseContext *self)
+{
+    if (self->tree != NULL && self->arena == NULL)
+    {
+        TreeNode__del(self->tree);
+    }
+
+    sParseContext__deinit(self);
+    free(self->window.tokens);
+    free(self);
+}
+
+TreeNode *Parser__parseSource(Parser *self, TokenSource *source)
+{
+    CCB_terminal_t windowBuffer[2 * self->k];
+    ParseContext context;
+
+    if (sParseContext__init(&context, self, windowBuffer) <= CCB_ERROR)
+    {
+        return NULL;
+    }
+
+    TreeNode *tree = ParseContext__parseSource(&context, source);
+
+    sParser__addStats(self, &context);
+    sParseContext__deinit(&context);
+
+    return tree;
+}
+
+TreeNode *Parser__parseRecords(Parser *self, const TokenRecord *records, size_t numOfRecords)
+{
+    CCB_terminal_t windowBuffer[2 * self->k];
+    ParseContext context;
+
+    if (sParseContext__init(&context, self, windowBuffer) <= CCB_ERROR)
+    {
+        return NULL;
+    }
+
+    TreeNode *tree = ParseContext__parseRecords(&context, records, numOfRecords);
+
+    sParser__addStats(self, &context);
+    sParseContext__deinit(&context);
+
     return tree;
 }
 
+TreeNode *Parser__parse(Parser *self, TokenQueue *input)
+{
+    TokenSource source = {.read = sTokenQueue__read, .context = input};
+
+    return Parser__parseSource(self, &source);
+}
+
+TreeNode *Parser__parseSpan(Parser *self,
+                            const CCB_terminal_t *tokens,
+                            size_t numOfTokens)
+{
+    CCB_terminal_t windowBuffer[2 * self->k];
+    ParseContext context;
+
+    if (sParseContext__init(&context, self, windowBuffer) <= CCB_ERROR)
+    {
+        return NULL;
+    }
+
+    TreeNode *tree = ParseContext__parseSpan(&context, tokens, numOfTokens);
+
+    sParser__addStats(self, &context);
+    sParseContext__deinit(&context);
+
+    return tree;
+}
+
+ParseContext *Parser__begin(Parser *self)
+{
+    ParseContext *context = ParseContext__new(self);
+
+    if (context == NULL)
+    {
+        return NULL;
+    }
+
+    context->statsParser = self;
+    ParseContext__begin(context);
+
+    return context;
+}
+
+TreeNode *Parser__finish(ParseContext *context)
+{
+    TreeNode *tree = ParseContext__finish(context);
+
+    if (context->statsParser != NULL)
+    {
+        sParser__addStats(context->statsParser, context);
+    }
+
+    ParseContext__del(context);
+
+    return tree;
+}
+
+/* Number of chunks each thread of a batch claims on average, so the threads that drew the
+longest inputs are balanced by the others, and largest chunk claimed at once */
+#define BATCH_CHUNKS_PER_THREAD 16
+#define MAX_BATCH_CHUNK_SIZE 256
+
+/* Inputs of a batch, claimed by its workers a chunk at a time */
+typedef struct ParseBatch
+{
+    const TokenSpan *inputs;
+    TreeNode **results;
+    size_t numOfInputs;
+    size_t chunkSize;
+    size_t nextInput;
+    pthread_mutex_t lock;
+} ParseBatch;
+
+typedef struct BatchWorker
+{
+    pthread_t thread;
+    ParseBatch *batch;
+    ParseContext *context;
+    size_t numOfFailures;
+} BatchWorker;
+
+/* Claims the next chunk of inputs, from `*start` to `*end`, or returns `false` once they are
+all claimed */
+static bool sParseBatch__claim(ParseBatch *self, size_t *start, size_t *end)
+{
+    pthread_mutex_lock(&self->lock);
+
+    *start = self->nextInput;
+    *end = self->numOfInputs - *start < self->chunkSize
+               ? self->numOfInputs
+               : *start + self->chunkSize;
+    self->nextInput = *end;
+
+    pthread_mutex_unlock(&self->lock);
+
+    return *start < *end;
+}
+
+static void *sBatchWorker__run(void *rawWorker)
+{
+    BatchWorker *worker = rawWorker;
+    ParseBatch *batch = worker->batch;
+    size_t start;
+    size_t end;
+
+    while (sParseBatch__claim(batch, &start, &end))
+    {
+        for (size_t i = start; i < end; i++)
+        {
+            batch->results[i] = ParseContext__parseSpan(
+                worker->context,
+                batch->inputs[i].tokens,
+                batch->inputs[i].numOfTokens);
+
+            if (batch->results[i] == NULL)
+            {
+                worker->numOfFailures++;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+int8_t Parser__parseBatch(Parser *self,
+                          const TokenSpan *inputs,
+                          size_t numOfInputs,
+                          TreeNode **results,
+                          ParseArena *const *arenas,
+                          unsigned numOfThreads)
+{
+    for (size_t i = 0; i < numOfInputs; i++)
+    {
+        results[i] = NULL;
+    }
+
+    if (arenas != NULL && numOfThreads == 0)
+    {
+        fprintf(stderr, "Failed to parse the batch, its arenas need a number of threads\n");
+        return CCB_ERROR;
+    }
+
+    if (numOfInputs == 0)
+    {
+        return CCB_SUCCESS;
+    }
+
+    if (numOfThreads == 0)
+    {
+        long numOfProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+        numOfThreads = numOfProcessors > 0 ? (unsigned)numOfProcessors : 1;
+    }
+
+    if (numOfThreads > numOfInputs)
+    {
+        numOfThreads = (unsigned)numOfInputs;
+    }
+
+    ParseBatch batch = {
+        .inputs = inputs,
+        .results = results,
+        .numOfInputs = numOfInputs,
+        .chunkSize = numOfInputs / ((size_t)numOfThreads * BATCH_CHUNKS_PER_THREAD),
+        .nextInput = 0,
+    };
+
+    if (batch.chunkSize == 0)
+    {
+        batch.chunkSize = 1;
+    }
+    else if (batch.chunkSize > MAX_BATCH_CHUNK_SIZE)
+    {
+        batch.chunkSize = MAX_BATCH_CHUNK_SIZE;
+    }
+
+    BatchWorker *workers = calloc(numOfThreads, sizeof(BatchWorker));
+
+    if (workers == NULL || pthread_mutex_init(&batch.lock, NULL) != 0)
+    {
+        fprintf(stderr, "Failed to set up the batch of %zu inputs\n", numOfInputs);
+        free(workers);
+        return CCB_ERROR;
+    }
+
+    int8_t status = CCB_SUCCESS;
+
+    for (unsigned i = 0; i < numOfThreads; i++)
+    {
+        workers[i].batch = &batch;
+        workers[i].context = ParseContext__new(self);
+
+        if (workers[i].context == NULL)
+        {
+            status = CCB_ERROR;
+        }
+        else if (arenas != NULL)
+        {
+            ParseContext__setArena(workers[i].context, arenas[i]);
+        }
+    }
+
+    unsigned numOfStartedThreads = 1;
+
+    if (status == CCB_SUCCESS)
+    {
+        /* The calling thread is the first worker. If a thread fails to start, the others
+        claim its share */
+        for (; numOfStartedThreads < numOfThreads; numOfStartedThreads++)
+        {
+            BatchWorker *worker = &workers[numOfStartedThreads];
+
+            if (pthread_create(&worker->thread, NULL, sBatchWorker__run, worker) != 0)
+            {
+                fprintf(stderr, "Failed to start batch thread %u\n", numOfStartedThreads);
+                break;
+            }
+        }
+
+        sBatchWorker__run(&workers[0]);
+
+        for (unsigned i = 1; i < numOfStartedThreads; i++)
+        {
+            pthread_join(workers[i].thread, NULL);
+        }
+    }
+
+    for (unsigned i = 0; i < numOfThreads; i++)
+    {
+        if (workers[i].context == NULL)
+        {
+            continue;
+        }
+
+        if (workers[i].numOfFailures > 0)
+        {
+            status = CCB_ERROR;
+        }
+
+        sParser__addStats(self, workers[i].context);
+        ParseContext__del(workers[i].context);
+    }
+
+    pthread_mutex_destroy(&batch.lock);
+    free(workers);
+
+    return status;
+}
+
+int8_t Parser__getStats(const Parser *self, ParserStats *stats)
+{
+#ifdef CCB_ENABLE_STATS
+    stats->numOfExpansions = PARSER_STATS_LOAD(self, numOfExpansions);
+    stats->numOfMatches = PARSER_STATS_LOAD(self, numOfMatches);
+
+    for (size_t i = 0; i < CCB_STATS_MAX_PREFIX_LENGTH; i++)
+    {
+        stats->numOfLookups[i] = PARSER_STATS_LOAD(self, numOfLookups[i]);
+    }
+
+    stats->maxStackDepth = PARSER_STATS_LOAD(self, maxStackDepth);
+    stats->numOfTokens = PARSER_STATS_LOAD(self, numOfTokens);
+    stats->numOfAllocations = PARSER_STATS_LOAD(self, numOfAllocations);
+    return CCB_SUCCESS;
+#else
+    (void)self;
+    memset(stats, 0x0, sizeof(ParserStats));
+    fprintf(stderr, "Failed to get the parser stats, built without CCB_ENABLE_STATS\n");
+    return CCB_ERROR;
+#endif
+}
+
+void Parser__resetStats(Parser *self)
+{
+#ifdef CCB_ENABLE_STATS
+    PARSER_STATS_CLEAR(self, numOfExpansions);
+    PARSER_STATS_CLEAR(self, numOfMatches);
+
+    for (size_t i = 0; i < CCB_STATS_MAX_PREFIX_LENGTH; i++)
+    {
+        PARSER_STATS_CLEAR(self, numOfLookups[i]);
+    }
+
+    PARSER_STATS_CLEAR(self, maxStackDepth);
+    PARSER_STATS_CLEAR(self, numOfTokens);
+    PARSER_STATS_CLEAR(self, numOfAllocations);
+#else
+    memset(&self->stats, 0x0, sizeof(ParserStats));
+#endif
+}
+
 void Parser__del(Parser *self)
 {
-    PrdcPrsnTble__del(self->prdcPrsnTble);
+    if (self->ownedGrammar != NULL)
+    {
+        Grammar__del(self->ownedGrammar);
+    }
+
+    free(self->productionActions);
     free(self);
 }
@@ -106,8 +106,8 @@ static char *sProductionData__rightHandStr(ProductionData *self)
     {
         fprintf(
             stderr,
-            "Failed to allocate memory to stringify P%d right hand side",
-            self->id);
+            "Failed to allocate memory to stringify P%ld right hand side",
+            (long)self->id);
         return NULL;
     }
 
@@ -154,8 +154,8 @@ char *ProductionData__str(ProductionData *self)
     {
         fprintf(
             stderr,
-            "Failed to allocate memory for the stringified P%d\n",
-            self->id);
+            "Failed to allocate memory for the stringified P%ld\n",
+            (long)self->id);
         return NULL;
     }
 
@@ -165,17 +165,17 @@ char *ProductionData__str(ProductionData *self)
     {
         fprintf(
             stderr,
-            "Failed to strigify production P%d right hand side\n",
-            self->id);
+            "Failed to strigify production P%ld right hand side\n",
+            (long)self->id);
         return NULL;
     }
 
     snprintf(
         prodDataStr,
         maxLength,
-        "ProductionData {id=P%d, leftHand=NT%d, rightHand={%s}}",
-        self->id,
-        self->leftHand,
+        "ProductionData {id=P%ld, leftHand=NT%lu, rightHand={%s}}",
+        (long)self->id,
+        (unsigned long)self->leftHand,
         rightHandStr);
 
     return prodDataStr;
@@ -22,8 +22,8 @@ int8_t ProductionsHashMap__initializeTerminal(ProductionsHashMap *self,
     {
         fprintf(
             stderr,
-            "Failed to create entry for NT%d",
-            nonterminal);
+            "Failed to create entry for NT%lu",
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
 
@@ -34,8 +34,8 @@ int8_t ProductionsHashMap__initializeTerminal(ProductionsHashMap *self,
     {
         fprintf(
             stderr,
-            "Failed to create linked list for the productions for nonterminal NT%d",
-            nonterminal);
+            "Failed to create linked list for the productions for nonterminal NT%lu",
+            (unsigned long)nonterminal);
         free(entry);
         return CCB_ERROR;
     }
@@ -51,8 +51,8 @@ int8_t ProductionsHashMap__initializeTerminal(ProductionsHashMap *self,
     {
         fprintf(
             stderr,
-            "Failed to map productions linked list to nonterminal NT%d",
-            nonterminal);
+            "Failed to map productions linked list to nonterminal NT%lu",
+            (unsigned long)nonterminal);
         DoublyLinkedListNode__del(entry->head);
         free(entry);
         return CCB_ERROR;
@@ -75,8 +75,8 @@ int8_t ProductionsHashMap__insertProdForTerminal(ProductionsHashMap *self,
     {
         fprintf(
             stderr,
-            "Failed to get productions linked list for nonterminal NT%d",
-            nonterminal);
+            "Failed to get productions linked list for nonterminal NT%lu",
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
 
@@ -87,8 +87,8 @@ int8_t ProductionsHashMap__insertProdForTerminal(ProductionsHashMap *self,
     {
         fprintf(
             stderr,
-            "Failed to map new production to nonterminal NT%d",
-            nonterminal);
+            "Failed to map new production to nonterminal NT%lu",
+            (unsigned long)nonterminal);
         return CCB_ERROR;
     }
 
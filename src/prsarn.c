@@ -0,0 +1,235 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cbarroso/sngllnkdlist.h>
+#include <cbarroso/tree.h>
+#include <ccabral/constants.h>
+#include <ccabral/prsarn.h>
+
+#define DEFAULT_BLOCK_SIZE (size_t)65536
+
+/* Largest alignment a node, its links or a copied value may need */
+#define ARENA_ALIGNMENT sizeof(union { long double ld; long long ll; void *p; })
+
+typedef struct ParseArenaBlock
+{
+    struct ParseArenaBlock *next;
+    size_t size;
+    unsigned char data[];
+} ParseArenaBlock;
+
+/* Blocks are kept from one reset to the next, and filled again in order */
+typedef struct ParseArena
+{
+    ParseArenaBlock *firstBlock;
+    ParseArenaBlock *currentBlock;
+    size_t position;
+    size_t blockSize;
+    size_t numOfBytes;
+
+    /* Last child inserted and its parent, so actions appending many children to one node do
+    not walk its children every time */
+    TreeNode *lastParent;
+    SinglyLinkedListNode *lastLink;
+} ParseArena;
+
+static ParseArenaBlock *sParseArenaBlock__new(size_t size)
+{
+    ParseArenaBlock *block = malloc(sizeof(ParseArenaBlock) + size);
+
+    if (block == NULL)
+    {
+        fprintf(stderr, "Failed to allocate a parse arena block of %zu bytes\n", size);
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->size = size;
+
+    return block;
+}
+
+ParseArena *ParseArena__new(size_t blockSize)
+{
+    ParseArena *arena = calloc(1, sizeof(ParseArena));
+
+    if (arena == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the parse arena\n");
+        return NULL;
+    }
+
+    arena->blockSize = blockSize == 0 ? DEFAULT_BLOCK_SIZE : blockSize;
+    arena->firstBlock = sParseArenaBlock__new(arena->blockSize);
+
+    if (arena->firstBlock == NULL)
+    {
+        free(arena);
+        return NULL;
+    }
+
+    arena->currentBlock = arena->firstBlock;
+
+    return arena;
+}
+
+/* Offset of the first byte from `position` on in `block` that is aligned for any type */
+static inline size_t sParseArenaBlock__align(const ParseArenaBlock *block, size_t position)
+{
+    uintptr_t address = (uintptr_t)&block->data[position];
+    uintptr_t padding = (ARENA_ALIGNMENT - address % ARENA_ALIGNMENT) % ARENA_ALIGNMENT;
+
+    return position + padding;
+}
+
+void *ParseArena__alloc(ParseArena *self, size_t size)
+{
+    size_t start = sParseArenaBlock__align(self->currentBlock, self->position);
+
+    /* Moves on to the next kept block, or adds one at least twice as large as the current */
+    while (start + size > self->currentBlock->size)
+    {
+        ParseArenaBlock *nextBlock = self->currentBlock->next;
+
+        if (nextBlock != NULL && nextBlock->size >= size + ARENA_ALIGNMENT)
+        {
+            self->currentBlock = nextBlock;
+            self->position = 0;
+            start = sParseArenaBlock__align(self->currentBlock, 0);
+            continue;
+        }
+
+        size_t newSize = 2 * self->currentBlock->size;
+
+        if (newSize < size + ARENA_ALIGNMENT)
+        {
+            newSize = size + ARENA_ALIGNMENT;
+        }
+
+        ParseArenaBlock *newBlock = sParseArenaBlock__new(newSize);
+
+        if (newBlock == NULL)
+        {
+            return NULL;
+        }
+
+        /* Kept blocks too small for `size` stay after the new one */
+        newBlock->next = nextBlock;
+        self->currentBlock->next = newBlock;
+        self->currentBlock = newBlock;
+        self->position = 0;
+        start = sParseArenaBlock__align(self->currentBlock, 0);
+    }
+
+    self->position = start + size;
+    self->numOfBytes += size;
+
+    return &self->currentBlock->data[start];
+}
+
+TreeNode *ParseArena__newTreeNode(ParseArena *self, void *value, size_t valueSize)
+{
+    if (self == NULL)
+    {
+        return TreeNode__new(value, valueSize);
+    }
+
+    TreeNode *node = ParseArena__alloc(self, sizeof(TreeNode));
+
+    if (node == NULL)
+    {
+        return NULL;
+    }
+
+    memset(node, 0x0, sizeof(TreeNode));
+
+    if (valueSize > 0)
+    {
+        node->value = ParseArena__alloc(self, valueSize);
+
+        if (node->value == NULL)
+        {
+            return NULL;
+        }
+
+        if (value != NULL)
+        {
+            memcpy(node->value, value, valueSize);
+        }
+    }
+
+    node->valueSize = valueSize;
+
+    return node;
+}
+
+int8_t ParseArena__insertTreeNode(ParseArena *self, TreeNode *parent, TreeNode *child)
+{
+    if (self == NULL)
+    {
+        return TreeNode__insert(parent, child);
+    }
+
+    if (child == NULL)
+    {
+        return CCB_ERROR;
+    }
+
+    SinglyLinkedListNode *link = ParseArena__alloc(self, sizeof(SinglyLinkedListNode));
+
+    if (link == NULL)
+    {
+        return CCB_ERROR;
+    }
+
+    memset(link, 0x0, sizeof(SinglyLinkedListNode));
+    link->value = child;
+    link->valueSize = sizeof(TreeNode);
+
+    SinglyLinkedListNode **tail = &parent->childrenHead;
+
+    if (parent == self->lastParent && self->lastLink->next == NULL)
+    {
+        tail = &self->lastLink->next;
+    }
+
+    while (*tail != NULL)
+    {
+        tail = &(*tail)->next;
+    }
+
+    *tail = link;
+    self->lastParent = parent;
+    self->lastLink = link;
+
+    return CCB_SUCCESS;
+}
+
+void ParseArena__reset(ParseArena *self)
+{
+    self->currentBlock = self->firstBlock;
+    self->position = 0;
+    self->numOfBytes = 0;
+    self->lastParent = NULL;
+    self->lastLink = NULL;
+}
+
+size_t ParseArena__getNumOfBytes(const ParseArena *self)
+{
+    return self->numOfBytes;
+}
+
+void ParseArena__del(ParseArena *self)
+{
+    ParseArenaBlock *block = self->firstBlock;
+
+    while (block != NULL)
+    {
+        ParseArenaBlock *nextBlock = block->next;
+        free(block);
+        block = nextBlock;
+    }
+
+    free(self);
+}
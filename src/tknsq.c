@@ -1,116 +1,195 @@
 #include <assert.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <clinschoten/constants.h>
-#include <clinschoten/logger.h>
-#include <ccabral/_grmmdata.h>
 #include <ccabral/types.h>
 #include <ccabral/constants.h>
 #include <ccabral/tknsq.h>
 
-int8_t TokenQueue__enqueue(TokenQueue *self, CCB_terminal_t newValue)
+#define INITIAL_CAPACITY 64
+
+static inline bool sTokenQueue__isTokenValid(CCB_terminal_t token)
+{
+    return (size_t)token < CCB_NUM_OF_TERMINALS;
+}
+
+/* Copies `numOfTokens` tokens starting at the ring position `start` into `buffer` */
+static void sTokenQueue__copyOut(const TokenQueue *self,
+                                 size_t start,
+                                 CCB_terminal_t *buffer,
+                                 size_t numOfTokens)
+{
+    size_t firstChunk = self->capacity - start;
+
+    if (firstChunk > numOfTokens)
+    {
+        firstChunk = numOfTokens;
+    }
+
+    memcpy(buffer, &self->tokens[start], firstChunk * sizeof(CCB_terminal_t));
+    memcpy(&buffer[firstChunk],
+           self->tokens,
+           (numOfTokens - firstChunk) * sizeof(CCB_terminal_t));
+}
+
+int8_t TokenQueue__reserve(TokenQueue *self, size_t numOfTokens)
 {
     assert(self != NULL);
 
-    const char *loggerName = "ProductionsHashMap__getProdDataFromNonterminalNRuleId";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
+    if (self->capacity - self->numberOfTokens >= numOfTokens)
+    {
+        return CCB_SUCCESS;
+    }
+
+    size_t newCapacity = self->capacity == 0 ? INITIAL_CAPACITY : self->capacity;
 
-    if (logger == NULL)
+    while (newCapacity - self->numberOfTokens < numOfTokens)
     {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n",
-            loggerName);
-        return CCB_ERROR;
+        newCapacity *= 2;
     }
 
-    if (!isGrammarValid(newValue, CCB_TERMINAL_GT))
+    CCB_terminal_t *newTokens = malloc(newCapacity * sizeof(CCB_terminal_t));
+
+    if (newTokens == NULL)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "TK%d is not a valid token",
-            32,
-            newValue);
-
-        ClnLogger__del(logger);
+        fprintf(stderr, "Failed to grow the token queue to %zu tokens\n", newCapacity);
         return CCB_ERROR;
     }
 
-    CCB_terminal_t *value = malloc(sizeof(CCB_terminal_t));
-    if (value == NULL)
+    if (self->numberOfTokens > 0)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to allocate memory for terminal value",
-            46);
+        sTokenQueue__copyOut(self, self->head, newTokens, self->numberOfTokens);
+    }
 
-        ClnLogger__del(logger);
-        return CCB_ERROR;
+    free(self->tokens);
+    self->tokens = newTokens;
+    self->capacity = newCapacity;
+    self->head = 0;
+
+    return CCB_SUCCESS;
+}
+
+TokenQueue *TokenQueue__new()
+{
+    TokenQueue *queue = calloc(1, sizeof(TokenQueue));
+
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the token queue\n");
+        return NULL;
     }
 
-    *value = newValue;
+    return queue;
+}
+
+int8_t TokenQueue__enqueue(TokenQueue *self, CCB_terminal_t newValue)
+{
+    assert(self != NULL);
 
-    if (Queue__enqueue(self, value, sizeof(CCB_terminal_t)) == -1)
+    if (!sTokenQueue__isTokenValid(newValue))
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Failed to enqueue terminal",
-            26);
-
-        free(value);
-        ClnLogger__del(logger);
+        fprintf(stderr, "TK%lu is not a valid token\n", (unsigned long)newValue);
         return CCB_ERROR;
     }
 
-    ClnLogger__del(logger);
+    if (self->numberOfTokens == self->capacity &&
+        TokenQueue__reserve(self, 1) <= CCB_ERROR)
+    {
+        return CCB_ERROR;
+    }
+
+    size_t tail = (self->head + self->numberOfTokens) & (self->capacity - 1);
+
+    self->tokens[tail] = newValue;
+    self->numberOfTokens++;
 
     return CCB_SUCCESS;
 }
 
-int8_t TokenQueue__dequeue(TokenQueue *self, CCB_terminal_t *valueAddress)
+int8_t TokenQueue__enqueueMany(TokenQueue *self,
+                               const CCB_terminal_t *tokens,
+                               size_t numOfTokens)
 {
     assert(self != NULL);
 
-    const char *loggerName = "TokenQueue__dequeue";
-    ClnLogger *logger = ClnLogger__new(loggerName, strlen(loggerName));
+    for (size_t i = 0; i < numOfTokens; i++)
+    {
+        if (!sTokenQueue__isTokenValid(tokens[i]))
+        {
+            fprintf(stderr, "TK%lu is not a valid token\n", (unsigned long)tokens[i]);
+            return CCB_ERROR;
+        }
+    }
 
-    if (logger == NULL)
+    if (TokenQueue__reserve(self, numOfTokens) <= CCB_ERROR)
     {
-        fprintf(
-            stderr,
-            "Failed to create logger '%s'\n", loggerName);
+        return CCB_ERROR;
+    }
 
-        return false;
+    if (numOfTokens == 0)
+    {
+        return CCB_SUCCESS;
     }
 
-    CCB_terminal_t *dequeuedPtr = NULL;
-    if (Queue__dequeue(self, (void **)&dequeuedPtr) == -1)
+    size_t tail = (self->head + self->numberOfTokens) & (self->capacity - 1);
+    size_t firstChunk = self->capacity - tail;
+
+    if (firstChunk > numOfTokens)
     {
-        ClnLogger__log(
-            logger,
-            CLN_ERROR_LL,
-            "Empty queue",
-            13);
+        firstChunk = numOfTokens;
+    }
+
+    memcpy(&self->tokens[tail], tokens, firstChunk * sizeof(CCB_terminal_t));
+    memcpy(self->tokens,
+           &tokens[firstChunk],
+           (numOfTokens - firstChunk) * sizeof(CCB_terminal_t));
+
+    self->numberOfTokens += numOfTokens;
+
+    return CCB_SUCCESS;
+}
 
-        ClnLogger__del(logger);
+int8_t TokenQueue__dequeue(TokenQueue *self, CCB_terminal_t *valueAddress)
+{
+    assert(self != NULL);
+
+    if (self->numberOfTokens == 0)
+    {
         return CCB_ERROR;
     }
 
-    *valueAddress = *dequeuedPtr;
-    free(dequeuedPtr);
+    *valueAddress = self->tokens[self->head];
+    self->head = (self->head + 1) & (self->capacity - 1);
+    self->numberOfTokens--;
 
-    ClnLogger__log(
-        logger,
-        CLN_DEBUG_LL,
-        "Dequeue T%d",
-        12,
-        *valueAddress);
+    return CCB_SUCCESS;
+}
 
-    ClnLogger__del(logger);
+size_t TokenQueue__dequeueMany(TokenQueue *self,
+                               CCB_terminal_t *buffer,
+                               size_t maxNumOfTokens)
+{
+    assert(self != NULL);
 
-    return CCB_SUCCESS;
+    size_t numOfTokens = self->numberOfTokens < maxNumOfTokens
+                             ? self->numberOfTokens
+                             : maxNumOfTokens;
+
+    if (numOfTokens == 0)
+    {
+        return 0;
+    }
+
+    sTokenQueue__copyOut(self, self->head, buffer, numOfTokens);
+    self->head = (self->head + numOfTokens) & (self->capacity - 1);
+    self->numberOfTokens -= numOfTokens;
+
+    return numOfTokens;
+}
+
+void TokenQueue__del(TokenQueue *self)
+{
+    free(self->tokens);
+    free(self);
 }
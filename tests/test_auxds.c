@@ -1,7 +1,11 @@
+#include <stdio.h>
+#include <string.h>
 #include <ccabral/_frstfllw.h>
 #include <ccabral/_grmmdata.h>
+#include <ccabral/_lkahd.h>
 #include <ccabral/_prdcdata.h>
 #include <ccabral/_prdcprsntble.h>
+#include <ccabral/_prdstble.h>
 #include <ccabral/prdcdata.h>
 #include <ccabral/prdsmap.h>
 #include <ccauchy.h>
@@ -106,6 +110,17 @@ TEST(test_auxds_grammar_data)
 
     ASSERT_EQ(data.id, 5, "Grammar id should be 5");
     ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Type should be CCB_TERMINAL_GT");
+
+    // The largest id of the build is printed whole
+    char expected[16];
+    data.id = (CCB_grammar_t)-1;
+    data.type = CCB_NONTERMINAL_GT;
+    snprintf(expected, sizeof(expected), "NT%lu", (unsigned long)data.id);
+
+    char *str = GrammarData__str(&data);
+    ASSERT_NOT_NULL(str, "String should not be NULL");
+    ASSERT(strcmp(str, expected) == 0, "String should not be truncated");
+    free(str);
 }
 
 // Test: Create ProductionData structure
@@ -199,7 +214,7 @@ TEST(test_auxds_build_first_simple)
     ProductionsHashMap *map = createProductionsHashMap(productions, CCB_NUM_OF_PRODUCTIONS);
     ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
 
-    FirstFollowEntry **first = First__new(map, 1);
+    FirstFollow *first = First__new(map, CCB_NUM_OF_NONTERMINALS, CCB_NUM_OF_TERMINALS, 1);
     ASSERT_NOT_NULL(first, "First set should not be NULL");
 
     // Cleanup
@@ -229,13 +244,14 @@ TEST(test_auxds_build_first_allocation)
     ProductionsHashMap *map = createProductionsHashMap(productions, CCB_NUM_OF_PRODUCTIONS);
     ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
 
-    FirstFollowEntry **first = First__new(map, 1);
+    // The grammar only defines START, so FIRST is sized for that one nonterminal
+    FirstFollow *first = First__new(map, CCB_START_NT + 1, CCB_NUM_OF_TERMINALS, 1);
     ASSERT_NOT_NULL(first, "First set should not be NULL");
 
     // Verify all nonterminal entries are allocated
-    for (uint8_t i = 0; i < CCB_NUM_OF_NONTERMINALS; i++)
+    for (size_t i = 0; i < first->numOfNonterminals; i++)
     {
-        ASSERT_NOT_NULL(first[i], "First entry for nonterminal should exist");
+        ASSERT_NOT_NULL(first->entries[i], "First entry for nonterminal should exist");
     }
 
     // Cleanup
@@ -265,10 +281,10 @@ TEST(test_auxds_build_follow_simple)
     ProductionsHashMap *map = createProductionsHashMap(productions, CCB_NUM_OF_PRODUCTIONS);
     ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
 
-    FirstFollowEntry **first = First__new(map, 1);
+    FirstFollow *first = First__new(map, CCB_NUM_OF_NONTERMINALS, CCB_NUM_OF_TERMINALS, 1);
     ASSERT_NOT_NULL(first, "First set should not be NULL");
 
-    FirstFollowEntry **follow = Follow__new(map, first, 1);
+    FirstFollow *follow = Follow__new(map, first, 1);
     ASSERT_NOT_NULL(follow, "Follow set should not be NULL");
 
     // Cleanup
@@ -278,6 +294,149 @@ TEST(test_auxds_build_follow_simple)
     free(productions);
 }
 
+static bool entryContains(FirstFollowEntry *entry, CCB_terminal_t first, CCB_terminal_t second)
+{
+    for (SinglyLinkedListNode *curr = entry->entriesHead; curr != NULL; curr = curr->next)
+    {
+        CCB_terminal_t *kSeq = curr->value;
+
+        if (kSeq[0] == first && kSeq[1] == second)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static size_t entryLength(FirstFollowEntry *entry)
+{
+    size_t length = 0;
+
+    for (SinglyLinkedListNode *curr = entry->entriesHead; curr != NULL; curr = curr->next)
+    {
+        length++;
+    }
+
+    return length;
+}
+
+// Test: FIRST and FOLLOW reach a fixpoint through recursion and nullable suffixes
+TEST(test_auxds_build_first_follow_fixpoint)
+{
+    if (CCB_NUM_OF_TERMINALS < 3)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    // S --> 'a' S | ε
+    ProductionData *productions[2];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[1] = createTestProduction(1, CCB_START_NT,
+                                          CCB_EMPTY_STRING_TR, CCB_TERMINAL_GT);
+    ASSERT_EQ(ProductionData__insertRightHandGrammar(productions[0], CCB_START_NT),
+              CCB_SUCCESS, "Inserting S should succeed");
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 2);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    FirstFollow *first = First__new(map, 1, 3, 2);
+    ASSERT_NOT_NULL(first, "First set should not be NULL");
+    ASSERT_EQ(entryLength(first->entries[CCB_START_NT]), 3, "FIRST(S) should have 3 sequences");
+    ASSERT(entryContains(first->entries[CCB_START_NT], 2, 2), "FIRST(S) should contain (a, a)");
+    ASSERT(entryContains(first->entries[CCB_START_NT], 2, CCB_EMPTY_STRING_TR),
+           "FIRST(S) should contain (a)");
+    ASSERT(entryContains(first->entries[CCB_START_NT], CCB_EMPTY_STRING_TR, CCB_EMPTY_STRING_TR),
+           "FIRST(S) should contain the empty string");
+
+    FirstFollow *follow = Follow__new(map, first, 2);
+    ASSERT_NOT_NULL(follow, "Follow set should not be NULL");
+    ASSERT_EQ(entryLength(follow->entries[CCB_START_NT]), 1, "FOLLOW(S) should have 1 sequence");
+    ASSERT(entryContains(follow->entries[CCB_START_NT], CCB_END_OF_TEXT_TR, CCB_EMPTY_STRING_TR),
+           "FOLLOW(S) should contain the end of text");
+
+    PrdcPrsnTble *parseTable = PrdcPrsnTble__new(map, 2);
+    ASSERT_NOT_NULL(parseTable, "Parse table should not be NULL");
+
+    uint8_t prefixLength;
+    CCB_terminal_t twoAs[] = {2, 2};
+    CCB_terminal_t lastA[] = {2, CCB_END_OF_TEXT_TR};
+    CCB_terminal_t end[] = {CCB_END_OF_TEXT_TR, CCB_END_OF_TEXT_TR};
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, twoAs, &prefixLength), 0,
+              "(a, a) should predict P0");
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, lastA, &prefixLength), 0,
+              "(a, END_OF_TEXT) should predict P0");
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, end, &prefixLength), 1,
+              "END_OF_TEXT should predict the empty production");
+
+    // Cleanup
+    PrdcPrsnTble__del(parseTable);
+    FirstFollow__del(follow);
+    FirstFollow__del(first);
+    ProductionsHashMap__del(map);
+}
+
+// Test: FIRST and FOLLOW are terminal sets for k = 1
+TEST(test_auxds_build_first_follow_terminal_sets)
+{
+    if (CCB_NUM_OF_TERMINALS < 131)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    // S --> 'a' S | 'b' | ε, with 'b' in the third word of the set
+    ProductionData *productions[3];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[1] = createTestProduction(1, CCB_START_NT, 130, CCB_TERMINAL_GT);
+    productions[2] = createTestProduction(2, CCB_START_NT,
+                                          CCB_EMPTY_STRING_TR, CCB_TERMINAL_GT);
+    ASSERT_EQ(ProductionData__insertRightHandGrammar(productions[0], CCB_START_NT),
+              CCB_SUCCESS, "Inserting S should succeed");
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 3);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    // Sized for the grammar rather than for every terminal the ids can name
+    FirstFollow *first = First__new(map, 1, 131, 1);
+    ASSERT_NOT_NULL(first, "First set should not be NULL");
+
+    TerminalSet *firstSet = &first->entries[CCB_START_NT]->terminals;
+    ASSERT_NULL(first->entries[CCB_START_NT]->entriesHead,
+                "Sequences should not be listed for k = 1");
+    ASSERT(TerminalSet__contains(firstSet, 2), "FIRST(S) should contain a");
+    ASSERT(TerminalSet__contains(firstSet, 130), "FIRST(S) should contain b");
+    ASSERT(TerminalSet__contains(firstSet, CCB_EMPTY_STRING_TR),
+           "FIRST(S) should contain the empty string");
+    ASSERT_EQ(TerminalSet__next(firstSet, 3), 130, "b should be the next terminal after a");
+    ASSERT_EQ(TerminalSet__next(firstSet, 131), 131, "No terminal should follow b");
+
+    FirstFollow *follow = Follow__new(map, first, 1);
+    ASSERT_NOT_NULL(follow, "Follow set should not be NULL");
+
+    TerminalSet *followSet = &follow->entries[CCB_START_NT]->terminals;
+    ASSERT_EQ(TerminalSet__next(followSet, 0), CCB_END_OF_TEXT_TR,
+              "FOLLOW(S) should start with the end of text");
+    ASSERT_EQ(TerminalSet__next(followSet, CCB_END_OF_TEXT_TR + 1), 131,
+              "FOLLOW(S) should only contain the end of text");
+
+    FirstFollowEntry *copy = FirstFollowEntry__new(131);
+    ASSERT_NOT_NULL(copy, "Entry should not be NULL");
+    ASSERT(TerminalSet__unionNonEmpty(&copy->terminals, followSet), "Union should add end of text");
+    ASSERT(TerminalSet__unionNonEmpty(&copy->terminals, firstSet), "Union should add a and b");
+    ASSERT(!TerminalSet__contains(&copy->terminals, CCB_EMPTY_STRING_TR),
+           "Union should not add the empty string");
+    ASSERT(!TerminalSet__unionNonEmpty(&copy->terminals, firstSet),
+           "Union should add nothing twice");
+
+    // Cleanup
+    FirstFollowEntry__del(copy);
+    FirstFollow__del(follow);
+    FirstFollow__del(first);
+    ProductionsHashMap__del(map);
+}
+
 // Test: buildPrdcPrsnTbl creates parse table
 TEST(test_auxds_build_parse_table)
 {
@@ -308,23 +467,234 @@ TEST(test_auxds_build_parse_table)
     free(productions);
 }
 
+// Test: LL(1) parse table is a dense nonterminal by terminal array
+TEST(test_auxds_parse_table_ll1_lookup)
+{
+    if (CCB_NUM_OF_PRODUCTIONS == 0)
+    {
+        printf("  (Skipped - no productions defined)\n");
+        return;
+    }
+
+    ProductionData **productions = malloc(sizeof(ProductionData *) * CCB_NUM_OF_PRODUCTIONS);
+    ASSERT_NOT_NULL(productions, "Productions array should not be NULL");
+
+    productions[0] = createTestProduction(0, CCB_START_NT,
+                                          CCB_END_OF_TEXT_TR, CCB_TERMINAL_GT);
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 1);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    PrdcPrsnTble *parseTable = PrdcPrsnTble__new(map, 1);
+    ASSERT_NOT_NULL(parseTable, "Parse table should not be NULL");
+    ASSERT_NOT_NULL(parseTable->ll1Table, "LL(1) table should be allocated");
+    ASSERT_NULL(parseTable->kSeqMaps, "LL(1) table should not use hash maps");
+
+    ASSERT_EQ(PrdcPrsnTble__getLL1Item(parseTable, CCB_START_NT, CCB_END_OF_TEXT_TR), 0,
+              "END_OF_TEXT should predict P0");
+    ASSERT_EQ(PrdcPrsnTble__getLL1Item(parseTable, CCB_START_NT, 42), CCB_ERROR_PR,
+              "Unmapped terminal should have no production");
+
+    CCB_terminal_t kSeq[] = {CCB_END_OF_TEXT_TR};
+    CCB_production_t production;
+    ASSERT_EQ(PrdcPrsnTble__getItem(parseTable, CCB_START_NT, kSeq, 1, &production), CCB_SUCCESS,
+              "getItem should succeed");
+    ASSERT_EQ(production, 0, "getItem should read the dense table");
+
+    // Cleanup
+    PrdcPrsnTble__del(parseTable);
+    ProductionsHashMap__del(map);
+    free(productions);
+}
+
+// Test: LL(k) parse table compiles a prediction trie
+TEST(test_auxds_parse_table_llk_trie)
+{
+    if (CCB_NUM_OF_PRODUCTIONS == 0)
+    {
+        printf("  (Skipped - no productions defined)\n");
+        return;
+    }
+
+    ProductionData **productions = malloc(sizeof(ProductionData *) * CCB_NUM_OF_PRODUCTIONS);
+    ASSERT_NOT_NULL(productions, "Productions array should not be NULL");
+
+    productions[0] = createTestProduction(0, CCB_START_NT,
+                                          CCB_END_OF_TEXT_TR, CCB_TERMINAL_GT);
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 1);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    PrdcPrsnTble *parseTable = PrdcPrsnTble__new(map, 2);
+    ASSERT_NOT_NULL(parseTable, "Parse table should not be NULL");
+    ASSERT_NOT_NULL(parseTable->trieNodes, "Trie should be compiled for k > 1");
+    ASSERT_NOT_NULL(parseTable->trieRoots, "Trie roots should be allocated");
+
+    uint8_t prefixLength = 0;
+    CCB_terminal_t matching[] = {CCB_END_OF_TEXT_TR, CCB_END_OF_TEXT_TR};
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, matching, &prefixLength), 0,
+              "Sequence starting with END_OF_TEXT should predict P0");
+    ASSERT_EQ(prefixLength, 1, "Single production should be decided by a 1-token prefix");
+
+    CCB_terminal_t unmatched[] = {42, CCB_END_OF_TEXT_TR};
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, unmatched, &prefixLength),
+              CCB_ERROR_PR,
+              "Unmapped sequence should have no production");
+
+    uint32_t rootIndex = parseTable->trieRoots[CCB_START_NT];
+    uint32_t firstStep = PrdcPrsnTble__getTrieChild(parseTable, rootIndex, CCB_END_OF_TEXT_TR);
+    ASSERT(firstStep != 0, "Trie should have a transition for END_OF_TEXT");
+    ASSERT(parseTable->trieNodes[firstStep].isDecisive,
+           "Single production should be decided after one token");
+
+    // Cleanup
+    PrdcPrsnTble__del(parseTable);
+    ProductionsHashMap__del(map);
+    free(productions);
+}
+
+// Test: LL(2) parse table needs the second token to tell `S -> a A | a B` apart
+TEST(test_auxds_parse_table_ll2_prediction)
+{
+    if (CCB_NUM_OF_NONTERMINALS < 3 || CCB_NUM_OF_TERMINALS < 5)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    // S -> a A | a B, A -> b, B -> c with a=2, b=3, c=4, A=1 and B=2
+    ProductionData *productions[4];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[1] = createTestProduction(1, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[2] = createTestProduction(2, 1, 3, CCB_TERMINAL_GT);
+    productions[3] = createTestProduction(3, 2, 4, CCB_TERMINAL_GT);
+    ASSERT_EQ(ProductionData__insertRightHandGrammar(productions[0], 1), CCB_SUCCESS,
+              "A should be appended to P0");
+    ASSERT_EQ(ProductionData__insertRightHandGrammar(productions[1], 2), CCB_SUCCESS,
+              "B should be appended to P1");
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 4);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    PrdcPrsnTble *parseTable = PrdcPrsnTble__new(map, 2);
+    ASSERT_NOT_NULL(parseTable, "Parse table should not be NULL");
+
+    uint8_t prefixLength = 0;
+    CCB_terminal_t ab[] = {2, 3};
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, ab, &prefixLength), 0,
+              "{a, b} should predict P0");
+    ASSERT_EQ(prefixLength, 2, "P0 should only be decided by the second token");
+
+    prefixLength = 0;
+    CCB_terminal_t ac[] = {2, 4};
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, ac, &prefixLength), 1,
+              "{a, c} should predict P1");
+    ASSERT_EQ(prefixLength, 2, "P1 should only be decided by the second token");
+
+    CCB_terminal_t ad[] = {2, 5};
+    ASSERT_EQ(PrdcPrsnTble__predict(parseTable, CCB_START_NT, ad, &prefixLength),
+              CCB_ERROR_PR,
+              "{a, d} should have no production");
+
+    uint32_t rootIndex = parseTable->trieRoots[CCB_START_NT];
+    uint32_t firstStep = PrdcPrsnTble__getTrieChild(parseTable, rootIndex, 2);
+    ASSERT(firstStep != 0, "Trie should have a transition for a");
+    ASSERT(!parseTable->trieNodes[firstStep].isDecisive,
+           "a alone should not decide between P0 and P1");
+
+    // Cleanup
+    PrdcPrsnTble__del(parseTable);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Parse tables survive a save and load round trip
+TEST(test_auxds_parse_table_save_load)
+{
+    if (CCB_NUM_OF_PRODUCTIONS == 0)
+    {
+        printf("  (Skipped - no productions defined)\n");
+        return;
+    }
+
+    const char *path = "test_auxds_parse_table.bin";
+    ProductionData *productions[1];
+    productions[0] = createTestProduction(0, CCB_START_NT,
+                                          CCB_END_OF_TEXT_TR, CCB_TERMINAL_GT);
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 1);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    for (uint8_t k = 1; k <= 2; k++)
+    {
+        PrdcPrsnTble *parseTable = PrdcPrsnTble__new(map, k);
+        ASSERT_NOT_NULL(parseTable, "Parse table should not be NULL");
+        ASSERT_EQ(PrdcPrsnTble__save(parseTable, 42, path), CCB_SUCCESS,
+                  "Saving the table should succeed");
+        PrdcPrsnTble__del(parseTable);
+
+        PrdcPrsnTble *loadedTable = PrdcPrsnTble__load(path, 42, 1, 1);
+        ASSERT_NOT_NULL(loadedTable, "Loading the table should succeed");
+        ASSERT_EQ(loadedTable->k, k, "Loaded table should keep k");
+        ASSERT_NOT_NULL(loadedTable->mapping, "Loaded table should be used in place");
+
+        uint8_t prefixLength;
+        CCB_terminal_t matching[] = {CCB_END_OF_TEXT_TR, CCB_END_OF_TEXT_TR};
+        CCB_terminal_t unmatched[] = {42, CCB_END_OF_TEXT_TR};
+        ASSERT_EQ(PrdcPrsnTble__predict(loadedTable, CCB_START_NT, matching, &prefixLength), 0,
+                  "Loaded table should predict P0 for END_OF_TEXT");
+        ASSERT_EQ(PrdcPrsnTble__predict(loadedTable, CCB_START_NT, unmatched, &prefixLength),
+                  CCB_ERROR_PR,
+                  "Loaded table should have no production for an unmapped sequence");
+
+        CCB_production_t production;
+        ASSERT_EQ(PrdcPrsnTble__getItem(loadedTable, CCB_START_NT, matching, k, &production),
+                  CCB_SUCCESS,
+                  "getItem should succeed on a loaded table");
+        ASSERT_EQ(production, k == 1 ? 0 : CCB_ERROR_PR,
+                  "getItem should only match the whole sequence");
+        PrdcPrsnTble__del(loadedTable);
+
+        ASSERT_NULL(PrdcPrsnTble__load(path, 43, 1, 1),
+                    "Loading a table saved for another grammar should fail");
+        ASSERT_NULL(PrdcPrsnTble__load(path, 42, 2, 1),
+                    "Loading a table sized for other nonterminals should fail");
+        ASSERT_NULL(PrdcPrsnTble__load(path, 42, 1, 0),
+                    "Loading a table predicting productions the grammar lacks should fail");
+
+        // Flip the last byte of the payload
+        FILE *file = fopen(path, "r+b");
+        ASSERT_NOT_NULL(file, "Table file should open");
+        fseek(file, -1, SEEK_END);
+        int lastByte = fgetc(file);
+        fseek(file, -1, SEEK_END);
+        fputc(lastByte ^ 0xFF, file);
+        fclose(file);
+
+        ASSERT_NULL(PrdcPrsnTble__load(path, 42, 1, 1), "Loading a corrupted table should fail");
+    }
+
+    ASSERT_NULL(PrdcPrsnTble__load("missing_parse_table.bin", 42, 1, 1),
+                "Loading a missing file should fail");
+
+    remove(path);
+    ProductionsHashMap__del(map);
+}
+
 // Test: FirstFollow__del function
 TEST(test_auxds_destroy_first_follow)
 {
     // Allocate a first/follow set
-    FirstFollowEntry **entries = malloc(sizeof(FirstFollowEntry *) * CCB_NUM_OF_NONTERMINALS);
-    ASSERT_NOT_NULL(entries, "Entries array should not be NULL");
+    FirstFollow *firstFollow = FirstFollow__new(CCB_NUM_OF_NONTERMINALS, CCB_NUM_OF_TERMINALS);
+    ASSERT_NOT_NULL(firstFollow, "First/follow table should not be NULL");
 
     for (uint8_t i = 0; i < CCB_NUM_OF_NONTERMINALS; i++)
     {
-        entries[i] = malloc(sizeof(FirstFollowEntry));
-        ASSERT_NOT_NULL(entries[i], "Entry should not be NULL");
-        entries[i]->entriesHead = NULL;
-        entries[i]->entriesTail = NULL;
+        firstFollow->entries[i] = FirstFollowEntry__new(firstFollow->numOfTerminals);
+        ASSERT_NOT_NULL(firstFollow->entries[i], "Entry should not be NULL");
     }
 
     // This should not crash
-    FirstFollow__del(entries);
+    FirstFollow__del(firstFollow);
 }
 
 // Test: GrammarData with different types
@@ -364,3 +734,153 @@ TEST(test_auxds_production_multiple_symbols)
 
     freeTestProduction(prod);
 }
+
+// Test: ProductionsTable stores right hand sides contiguously and reversed
+TEST(test_auxds_productions_table)
+{
+    ProductionData *productions[2];
+
+    productions[0] = createTestProduction(0, CCB_START_NT, 5, CCB_TERMINAL_GT);
+    ASSERT_NOT_NULL(productions[0], "Production should not be NULL");
+
+    GrammarData startGrammar = {CCB_START_NT, CCB_NONTERMINAL_GT};
+    DoublyLinkedListNode__insertAtTail(productions[0]->rightHandTail,
+                                       &startGrammar, sizeof(GrammarData));
+    productions[0]->rightHandTail = productions[0]->rightHandTail->next;
+
+    productions[1] = createTestProduction(1, CCB_START_NT,
+                                          CCB_EMPTY_STRING_TR, CCB_TERMINAL_GT);
+    ASSERT_NOT_NULL(productions[1], "Production should not be NULL");
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 2);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    ProductionsTable *table = ProductionsTable__new(map);
+    ASSERT_NOT_NULL(table, "ProductionsTable should not be NULL");
+    ASSERT_EQ(table->numOfProductions, 2, "Table should have a slot per production");
+    ASSERT_EQ(table->leftHands[0], CCB_START_NT, "P0 left hand should be START");
+
+    uint8_t rightHandLength;
+    const GrammarData *rightHand = ProductionsTable__getRightHand(table, 0, &rightHandLength);
+    ASSERT_EQ(rightHandLength, 2, "P0 right hand should have 2 grammars");
+    ASSERT_EQ(rightHand[0].id, CCB_START_NT, "Last grammar should come first");
+    ASSERT_EQ(rightHand[0].type, CCB_NONTERMINAL_GT, "Last grammar should be a nonterminal");
+    ASSERT_EQ(rightHand[1].id, 5, "First grammar should come last");
+    ASSERT_EQ(rightHand[1].type, CCB_TERMINAL_GT, "First grammar should be a terminal");
+
+    ProductionsTable__getRightHand(table, 1, &rightHandLength);
+    ASSERT_EQ(rightHandLength, 0, "Empty string production should have no grammars");
+
+    // Cleanup
+    ProductionsTable__del(table);
+    ProductionsHashMap__del(map);
+}
+
+// Helper function to create the productions START -> 5 START | epsilon, with every byte of their
+// grammars, padding included, first set to `fill`
+static ProductionsHashMap *createFilledProductions(unsigned char fill)
+{
+    ProductionData *productions[2];
+    GrammarData grammars[3];
+
+    memset(grammars, fill, sizeof(grammars));
+    grammars[0].id = 5;
+    grammars[0].type = CCB_TERMINAL_GT;
+    grammars[1].id = CCB_START_NT;
+    grammars[1].type = CCB_NONTERMINAL_GT;
+    grammars[2].id = CCB_EMPTY_STRING_TR;
+    grammars[2].type = CCB_TERMINAL_GT;
+
+    for (CCB_production_t id = 0; id < 2; id++)
+    {
+        productions[id] = malloc(sizeof(ProductionData));
+        productions[id]->id = id;
+        productions[id]->leftHand = CCB_START_NT;
+        productions[id]->rightHandHead =
+            DoublyLinkedListNode__new(&grammars[id == 0 ? 0 : 2], sizeof(GrammarData));
+        productions[id]->rightHandTail = productions[id]->rightHandHead;
+    }
+
+    DoublyLinkedListNode__insertAtTail(productions[0]->rightHandTail,
+                                       &grammars[1], sizeof(GrammarData));
+    productions[0]->rightHandTail = productions[0]->rightHandTail->next;
+
+    return createProductionsHashMap(productions, 2);
+}
+
+// Test: The hash of a productions table does not depend on the padding of its grammars
+TEST(test_auxds_productions_table_hash)
+{
+    ProductionsHashMap *zeroedMap = createFilledProductions(0x00);
+    ProductionsHashMap *filledMap = createFilledProductions(0xA5);
+    ASSERT_NOT_NULL(zeroedMap, "ProductionsHashMap should not be NULL");
+    ASSERT_NOT_NULL(filledMap, "ProductionsHashMap should not be NULL");
+
+    ProductionsTable *zeroedTable = ProductionsTable__new(zeroedMap);
+    ProductionsTable *filledTable = ProductionsTable__new(filledMap);
+    ASSERT_NOT_NULL(zeroedTable, "ProductionsTable should not be NULL");
+    ASSERT_NOT_NULL(filledTable, "ProductionsTable should not be NULL");
+
+    ASSERT(ProductionsTable__hash(zeroedTable) == ProductionsTable__hash(filledTable),
+           "Tables of the same grammar should have the same hash");
+
+    ProductionsTable__del(zeroedTable);
+    ProductionsTable__del(filledTable);
+    ProductionsHashMap__del(zeroedMap);
+    ProductionsHashMap__del(filledMap);
+}
+
+// Test: Circular lookahead window keeps the last k tokens in order
+TEST(test_auxds_lookahead_window)
+{
+    const uint8_t k = 3;
+    CCB_terminal_t buffer[2 * k];
+    Lookahead lookahead;
+
+    Lookahead__init(&lookahead, buffer, k);
+
+    for (uint8_t i = 0; i < k; i++)
+    {
+        ASSERT_EQ(Lookahead__get(&lookahead, i), CCB_END_OF_TEXT_TR,
+                  "New window should only have end of texts");
+    }
+
+    for (CCB_terminal_t token = 2; token < 12; token++)
+    {
+        Lookahead__push(&lookahead, token);
+
+        const CCB_terminal_t *window = Lookahead__window(&lookahead);
+
+        for (uint8_t i = 0; i < k; i++)
+        {
+            int expected = token - (k - 1) + i;
+
+            if (expected < 2)
+            {
+                expected = CCB_END_OF_TEXT_TR;
+            }
+
+            ASSERT_EQ(window[i], expected, "Window should hold the last k tokens in order");
+            ASSERT_EQ(Lookahead__get(&lookahead, i), expected,
+                      "Accessor should match the window");
+        }
+    }
+    // A window over 128 tokens, written far past its head
+    const uint8_t wideK = 200;
+    CCB_terminal_t wideBuffer[2 * wideK];
+    Lookahead wideLookahead;
+
+    Lookahead__init(&wideLookahead, wideBuffer, wideK);
+
+    for (uint8_t i = 0; i < 150; i++)
+    {
+        Lookahead__push(&wideLookahead, 2);
+    }
+
+    Lookahead__set(&wideLookahead, 199, 7);
+    ASSERT_EQ(Lookahead__get(&wideLookahead, 199), 7, "Last token should be replaced");
+    ASSERT_EQ(Lookahead__window(&wideLookahead)[199], 7, "Window should see the replacement");
+    ASSERT_EQ(Lookahead__get(&wideLookahead, 49), CCB_END_OF_TEXT_TR,
+              "Other tokens should be kept");
+    ASSERT_EQ(Lookahead__get(&wideLookahead, 50), 2, "Other tokens should be kept");
+}
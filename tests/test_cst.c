@@ -0,0 +1,63 @@
+#include <stddef.h>
+#include <ccabral/_cst.h>
+#include <ccabral/cst.h>
+#include <ccabral/constants.h>
+#include <ccauchy.h>
+
+// Test: Create a new ConcreteSyntaxTree
+TEST(test_cst_new)
+{
+    ConcreteSyntaxTree *tree = ConcreteSyntaxTree__new(0);
+    ASSERT_NOT_NULL(tree, "ConcreteSyntaxTree should not be NULL");
+    ASSERT_EQ(tree->numOfNodes, 0, "New tree should be empty");
+    ASSERT(tree->capacity > 0, "New tree should have room for nodes");
+
+    ConcreteSyntaxTree__del(tree);
+}
+
+// Test: Nodes are linked to their parent and previous sibling, and the arrays grow
+TEST(test_cst_add_node)
+{
+    ConcreteSyntaxTree *tree = ConcreteSyntaxTree__new(2);
+    ASSERT_NOT_NULL(tree, "ConcreteSyntaxTree should not be NULL");
+
+    size_t root = ConcreteSyntaxTree__addNode(tree, 0, CCB_EMPTY_STRING_TR,
+                                              CCB_NO_NODE, CCB_NO_NODE, 0);
+    ASSERT_EQ(root, 0, "Root should be the first node");
+    ASSERT_EQ(tree->parents[root], CCB_NO_NODE, "Root should have no parent");
+
+    // A chain of 100 children of the root, past the initial capacity
+    size_t previousSibling = CCB_NO_NODE;
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        size_t node = ConcreteSyntaxTree__addNode(tree, CCB_ERROR_PR, 2, root, previousSibling, i);
+        ASSERT_EQ(node, i + 1, "Nodes should be numbered in order");
+        previousSibling = node;
+    }
+
+    ASSERT_EQ(tree->numOfNodes, 101, "Every node should be added");
+    ASSERT(tree->capacity >= 101, "Arrays should grow");
+    ASSERT_EQ(tree->firstChildren[root], 1, "First child should be linked to the root");
+
+    size_t numOfChildren = 0;
+
+    for (size_t child = tree->firstChildren[root];
+         child != CCB_NO_NODE;
+         child = tree->nextSiblings[child])
+    {
+        ASSERT_EQ(tree->parents[child], root, "Children should point to the root");
+        ASSERT_EQ(tree->terminals[child], 2, "Children should keep their terminal");
+        ASSERT_EQ(tree->tokenStarts[child], numOfChildren, "Children should keep their start");
+        ASSERT_EQ(tree->firstChildren[child], CCB_NO_NODE, "Children should be leaves");
+        numOfChildren++;
+    }
+
+    ASSERT_EQ(numOfChildren, 100, "Every child should be reached from the root");
+
+    ConcreteSyntaxTree__clear(tree);
+    ASSERT_EQ(tree->numOfNodes, 0, "Cleared tree should be empty");
+    ASSERT(tree->capacity >= 101, "Cleared tree should keep its arrays");
+
+    ConcreteSyntaxTree__del(tree);
+}
@@ -1,8 +1,12 @@
+#include <pthread.h>
+#include <ccabral/grmmr.h>
 #include <ccabral/parser.h>
 #include <ccabral/tknsq.h>
+#include <ccabral/tknsrc.h>
 #include <ccabral/_grmmdata.h>
 #include <ccabral/_prdcdata.h>
 #include <ccabral/_prdsmap.h>
+#include <ccabral/_sttcprsr.h>
 #include <ccabral/prdcdata.h>
 #include <ccabral/prdsmap.h>
 #include <ccabral/constants.h>
@@ -20,6 +24,40 @@ static int8_t mockRuleAction(TreeNode **tree, CCB_production_t production)
     return CCB_SUCCESS;
 }
 
+// Rule action adding a child to the root for every expansion, so trees can be told apart
+static int8_t countingRuleAction(TreeNode **tree, CCB_production_t production)
+{
+    if (*tree == NULL)
+    {
+        *tree = TreeNode__new(NULL, 0);
+    }
+
+    return TreeNode__insert(*tree, TreeNode__new(NULL, 0));
+}
+
+// Same as countingRuleAction, building the tree in the arena of the parse if it has one
+static int8_t arenaRuleAction(TreeNode **tree, CCB_production_t production, ParseArena *arena)
+{
+    if (*tree == NULL)
+    {
+        *tree = ParseArena__newTreeNode(arena, NULL, 0);
+    }
+
+    return ParseArena__insertTreeNode(arena, *tree, ParseArena__newTreeNode(arena, NULL, 0));
+}
+
+static size_t countChildren(const TreeNode *tree)
+{
+    size_t numOfChildren = 0;
+
+    for (SinglyLinkedListNode *child = tree->childrenHead; child != NULL; child = child->next)
+    {
+        numOfChildren++;
+    }
+
+    return numOfChildren;
+}
+
 // Helper function to create a simple production for testing
 static ProductionData *createTestProduction(CCB_production_t id,
                                             CCB_nonterminal_t leftHand,
@@ -109,6 +147,25 @@ static ProductionsHashMap *createProductionsHashMap(ProductionData **productions
     return map;
 }
 
+// Helper function to create the map of P0: START -> 2 START, P1: START -> epsilon
+static ProductionsHashMap *createRecursiveProductionsMap(void)
+{
+    ProductionData *productions[2];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[1] = createTestProduction(1, CCB_START_NT,
+                                          CCB_EMPTY_STRING_TR, CCB_TERMINAL_GT);
+
+    if (productions[0] == NULL || productions[1] == NULL ||
+        ProductionData__insertRightHandGrammar(productions[0], CCB_START_NT) <= CCB_ERROR)
+    {
+        freeTestProduction(productions[0]);
+        freeTestProduction(productions[1]);
+        return NULL;
+    }
+
+    return createProductionsHashMap(productions, 2);
+}
+
 // Test: Create a new Parser
 TEST(test_parser_new)
 {
@@ -223,14 +280,14 @@ TEST(test_parser_parse_empty_input)
     ASSERT_NOT_NULL(parser, "Parser should not be NULL");
 
     // Create empty token queue
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     // Parse should fail with empty queue
     TreeNode *tree = Parser__parse(parser, queue);
     ASSERT_NULL(tree, "Parse should return NULL for empty input");
 
-    free(queue);
+    TokenQueue__del(queue);
     Parser__del(parser);
     ProductionsHashMap__del(map);
     free(productions);
@@ -259,7 +316,7 @@ TEST(test_parser_parse_single_eot_token)
     ASSERT_NOT_NULL(parser, "Parser should not be NULL");
 
     // Create token queue with just EOT
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     TokenQueue__enqueue(queue, CCB_END_OF_TEXT_TR);
 
     // Note: Parsing behavior depends on the grammar defined
@@ -272,7 +329,7 @@ TEST(test_parser_parse_single_eot_token)
         TreeNode__del(tree);
     }
 
-    free(queue);
+    TokenQueue__del(queue);
     Parser__del(parser);
     ProductionsHashMap__del(map);
     free(productions);
@@ -411,3 +468,1309 @@ TEST(test_parser_multiple_instances)
     free(productions1);
     free(productions2);
 }
+
+// Test: Parse a caller-owned token span
+TEST(test_parser_parse_span)
+{
+    if (CCB_NUM_OF_PRODUCTIONS == 0 || CCB_NUM_OF_TERMINALS < 3)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    ProductionData **productions = malloc(sizeof(ProductionData *) * CCB_NUM_OF_PRODUCTIONS);
+    for (uint8_t i = 0; i < CCB_NUM_OF_PRODUCTIONS; i++)
+    {
+        productions[i] = createTestProduction(i, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    }
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, CCB_NUM_OF_PRODUCTIONS);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    for (uint8_t k = 1; k <= 3; k++)
+    {
+        Parser *parser = Parser__new(map, mockRuleAction, k);
+        ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+        const CCB_terminal_t validTokens[] = {2, CCB_END_OF_TEXT_TR};
+        TreeNode *tree = Parser__parseSpan(parser, validTokens, 2);
+        ASSERT_NOT_NULL(tree, "Parse should succeed for a valid span");
+        TreeNode__del(tree);
+
+        // The end of text is implied past the end of the span
+        tree = Parser__parseSpan(parser, validTokens, 1);
+        ASSERT_NOT_NULL(tree, "Parse should succeed without a trailing end of text");
+        TreeNode__del(tree);
+
+        const CCB_terminal_t trailingTokens[] = {2, 2, CCB_END_OF_TEXT_TR};
+        tree = Parser__parseSpan(parser, trailingTokens, 3);
+        ASSERT_NULL(tree, "Parse should fail with trailing tokens");
+
+        tree = Parser__parseSpan(parser, validTokens, 0);
+        ASSERT_NULL(tree, "Parse should fail for an empty span");
+
+        Parser__del(parser);
+    }
+
+    ProductionsHashMap__del(map);
+    free(productions);
+}
+
+static CCB_production_t sAppliedProductions[4];
+static size_t sNumOfAppliedProductions = 0;
+
+static int8_t recordProductionAction(TreeNode **tree, CCB_production_t production)
+{
+    if (*tree == NULL)
+    {
+        *tree = TreeNode__new(NULL, 0);
+    }
+    if (sNumOfAppliedProductions < 4)
+    {
+        sAppliedProductions[sNumOfAppliedProductions] = production;
+    }
+    sNumOfAppliedProductions++;
+    return CCB_SUCCESS;
+}
+
+// Test: Parse a span whose productions are only decided by the second token
+TEST(test_parser_parse_span_ll2)
+{
+    if (CCB_NUM_OF_NONTERMINALS < 3 || CCB_NUM_OF_TERMINALS < 5)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    // S -> a A | a B, A -> b, B -> c with a=2, b=3, c=4, A=1 and B=2
+    ProductionData *productions[4];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[1] = createTestProduction(1, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    productions[2] = createTestProduction(2, 1, 3, CCB_TERMINAL_GT);
+    productions[3] = createTestProduction(3, 2, 4, CCB_TERMINAL_GT);
+    ProductionData__insertRightHandGrammar(productions[0], 1);
+    ProductionData__insertRightHandGrammar(productions[1], 2);
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 4);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    for (uint8_t k = 2; k <= 3; k++)
+    {
+        Parser *parser = Parser__new(map, recordProductionAction, k);
+        ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+        sNumOfAppliedProductions = 0;
+        const CCB_terminal_t abTokens[] = {2, 3};
+        TreeNode *tree = Parser__parseSpan(parser, abTokens, 2);
+        ASSERT_NOT_NULL(tree, "Parse should succeed for a b");
+        ASSERT_EQ(sNumOfAppliedProductions, 2, "a b should apply two productions");
+        ASSERT_EQ(sAppliedProductions[0], 0, "S should derive a A");
+        ASSERT_EQ(sAppliedProductions[1], 2, "A should derive b");
+        TreeNode__del(tree);
+
+        sNumOfAppliedProductions = 0;
+        const CCB_terminal_t acTokens[] = {2, 4};
+        tree = Parser__parseSpan(parser, acTokens, 2);
+        ASSERT_NOT_NULL(tree, "Parse should succeed for a c");
+        ASSERT_EQ(sNumOfAppliedProductions, 2, "a c should apply two productions");
+        ASSERT_EQ(sAppliedProductions[0], 1, "S should derive a B");
+        ASSERT_EQ(sAppliedProductions[1], 3, "B should derive c");
+        TreeNode__del(tree);
+
+        const CCB_terminal_t adTokens[] = {2, 5};
+        tree = Parser__parseSpan(parser, adTokens, 2);
+        ASSERT_NULL(tree, "Parse should fail for a d");
+
+        tree = Parser__parseSpan(parser, abTokens, 1);
+        ASSERT_NULL(tree, "Parse should fail for a alone");
+
+        Parser__del(parser);
+    }
+
+    ProductionsHashMap__del(map);
+}
+
+// Token source that hands out the tokens of an array in small batches
+typedef struct ChunkedSource
+{
+    const CCB_terminal_t *tokens;
+    size_t numOfTokens;
+    size_t position;
+    size_t chunkSize;
+} ChunkedSource;
+
+static size_t sChunkedSourceRead(void *context, CCB_terminal_t *buffer, size_t capacity)
+{
+    ChunkedSource *source = context;
+    size_t numOfTokens = source->numOfTokens - source->position;
+
+    if (numOfTokens > source->chunkSize)
+        numOfTokens = source->chunkSize;
+
+    if (numOfTokens > capacity)
+        numOfTokens = capacity;
+
+    memcpy(buffer, &source->tokens[source->position], numOfTokens * sizeof(CCB_terminal_t));
+    source->position += numOfTokens;
+
+    return numOfTokens;
+}
+
+static ChunkedSource *sActiveSource = NULL;
+static size_t sTokensReadAtFirstAction = 0;
+
+static int8_t recordFirstAction(TreeNode **tree, CCB_production_t production)
+{
+    if (*tree == NULL)
+    {
+        *tree = TreeNode__new(NULL, 0);
+        sTokensReadAtFirstAction = sActiveSource->position;
+    }
+    return CCB_SUCCESS;
+}
+
+// Test: Parse tokens pulled from a token source
+TEST(test_parser_parse_source)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, recordFirstAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    size_t numOfTokens = 4096;
+    CCB_terminal_t *tokens = malloc(numOfTokens * sizeof(CCB_terminal_t));
+    for (size_t i = 0; i < numOfTokens; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    ChunkedSource chunkedSource = {tokens, numOfTokens, 0, 7};
+    TokenSource source = {sChunkedSourceRead, &chunkedSource};
+    sActiveSource = &chunkedSource;
+
+    TreeNode *tree = Parser__parseSource(parser, &source);
+    ASSERT_NOT_NULL(tree, "Parse should succeed");
+    ASSERT_EQ(chunkedSource.position, numOfTokens, "Every token should be read");
+    ASSERT(sTokensReadAtFirstAction < numOfTokens,
+           "Parsing should start before the whole input is read");
+    TreeNode__del(tree);
+
+    // A token the grammar does not accept stops the parse
+    tokens[numOfTokens / 2] = 3;
+    chunkedSource.position = 0;
+    tree = Parser__parseSource(parser, &source);
+    ASSERT_NULL(tree, "Parse should fail on an unexpected token");
+
+    // An empty source has no lookahead
+    chunkedSource.numOfTokens = 0;
+    chunkedSource.position = 0;
+    tree = Parser__parseSource(parser, &source);
+    ASSERT_NULL(tree, "Parse should fail for an empty source");
+
+    sActiveSource = NULL;
+    free(tokens);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Parse input pushed in chunks
+TEST(test_parser_push_chunks)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    CCB_terminal_t tokens[64];
+
+    for (size_t i = 0; i < 64; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    Parser *parser = Parser__new(map, mockRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    for (size_t chunkSize = 1; chunkSize <= 5; chunkSize++)
+    {
+        ParseContext *context = Parser__begin(parser);
+        ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+
+        for (size_t position = 0; position < 64; position += chunkSize)
+        {
+            size_t size = 64 - position < chunkSize ? 64 - position : chunkSize;
+            int8_t result = Parser__feed(context, &tokens[position], size);
+            ASSERT_EQ(result, CCB_SUCCESS, "Feeding a valid chunk should succeed");
+
+            // Empty chunks are allowed
+            result = Parser__feed(context, NULL, 0);
+            ASSERT_EQ(result, CCB_SUCCESS, "Feeding an empty chunk should succeed");
+        }
+
+        TreeNode *tree = Parser__finish(context);
+        ASSERT_NOT_NULL(tree, "Parse should succeed");
+        TreeNode__del(tree);
+    }
+
+    // A token the grammar does not accept fails the feed it arrives in
+    ParseContext *context = Parser__begin(parser);
+    const CCB_terminal_t invalidTokens[] = {2, 2, 3, 2, 2, 2, 2};
+    int8_t result = Parser__feed(context, invalidTokens, 7);
+    ASSERT_EQ(result, CCB_ERROR, "Feeding an unexpected token should fail");
+    result = Parser__feed(context, tokens, 1);
+    ASSERT_EQ(result, CCB_ERROR, "Feeding a failed parse should fail");
+    ASSERT_NULL(Parser__finish(context), "Finishing a failed parse should return NULL");
+
+    // No input at all has no lookahead
+    context = Parser__begin(parser);
+    ASSERT_NULL(Parser__finish(context), "Finishing an empty parse should return NULL");
+
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+#ifdef CCB_ENABLE_STATS
+// Parses the same ten tokens a hundred times through the `Parser__` functions
+static void *parseSpansInThread(void *rawParser)
+{
+    CCB_terminal_t tokens[10] = {2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        TreeNode__del(Parser__parseSpan(rawParser, tokens, 10));
+    }
+
+    return NULL;
+}
+#endif
+
+// Test: Parser statistics count the work of the parses
+TEST(test_parser_stats)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, mockRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    CCB_terminal_t tokens[10];
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    TreeNode *tree = Parser__parseSpan(parser, tokens, 10);
+    ASSERT_NOT_NULL(tree, "Parse should succeed");
+    TreeNode__del(tree);
+
+    ParserStats stats;
+
+#ifdef CCB_ENABLE_STATS
+    ASSERT_EQ(Parser__getStats(parser, &stats), CCB_SUCCESS, "Getting stats should succeed");
+    ASSERT_EQ(stats.numOfExpansions, 11, "Every token and the end should be expanded");
+    ASSERT_EQ(stats.numOfMatches, 10, "Every token should be matched");
+    ASSERT_EQ(stats.numOfLookups[0], 11, "LL(1) lookups should use a 1-token prefix");
+    ASSERT_EQ(stats.numOfLookups[1], 0, "LL(1) lookups should not use longer prefixes");
+    ASSERT_EQ(stats.maxStackDepth, 3, "Stack should hold the end of text and one expansion");
+    ASSERT_EQ(stats.numOfTokens, 10, "Every token should be read");
+    ASSERT(stats.numOfAllocations > 0, "Creating the parser stack should be counted");
+
+    // Counters keep adding up until they are reset
+    tree = Parser__parseSpan(parser, tokens, 10);
+    ASSERT_NOT_NULL(tree, "Parse should succeed");
+    TreeNode__del(tree);
+    ASSERT_EQ(Parser__getStats(parser, &stats), CCB_SUCCESS, "Getting stats should succeed");
+    ASSERT_EQ(stats.numOfMatches, 20, "Matches of both parses should be counted");
+
+    Parser__resetStats(parser);
+    ASSERT_EQ(Parser__getStats(parser, &stats), CCB_SUCCESS, "Getting stats should succeed");
+    ASSERT_EQ(stats.numOfExpansions, 0, "Reset should clear the expansions");
+    ASSERT_EQ(stats.maxStackDepth, 0, "Reset should clear the stack depth");
+
+    // Parses of several threads at once add up without losing counts
+    pthread_t threads[4];
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        ASSERT_EQ(pthread_create(&threads[i], NULL, parseSpansInThread, parser), 0,
+                  "Creating a thread should succeed");
+    }
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    ASSERT_EQ(Parser__getStats(parser, &stats), CCB_SUCCESS, "Getting stats should succeed");
+    ASSERT_EQ(stats.numOfMatches, 4000, "Matches of every thread should be counted");
+    ASSERT_EQ(stats.maxStackDepth, 3, "Stack depth should be the deepest of all parses");
+#else
+    ASSERT_EQ(Parser__getStats(parser, &stats), CCB_ERROR,
+              "Getting stats should fail when they are not compiled in");
+    ASSERT_EQ(stats.numOfExpansions, 0, "Stats should be zeroed when they are not compiled in");
+#endif
+
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Create a parser from a saved table
+TEST(test_parser_new_from_table)
+{
+    if (CCB_NUM_OF_PRODUCTIONS == 0 || CCB_NUM_OF_TERMINALS < 3)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    const char *path = "test_parser_table.bin";
+    ProductionData *productions[1];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 1);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    for (uint8_t k = 1; k <= 3; k++)
+    {
+        Parser *parser = Parser__new(map, mockRuleAction, k);
+        ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+        ASSERT_EQ(Parser__saveTable(parser, path), CCB_SUCCESS, "Saving the table should succeed");
+        Parser__del(parser);
+
+        Parser *loadedParser = Parser__newFromTable(map, mockRuleAction, path);
+        ASSERT_NOT_NULL(loadedParser, "Parser should be created from the table");
+
+        const CCB_terminal_t validTokens[] = {2};
+        TreeNode *tree = Parser__parseSpan(loadedParser, validTokens, 1);
+        ASSERT_NOT_NULL(tree, "Parse should succeed with the loaded table");
+        TreeNode__del(tree);
+
+        const CCB_terminal_t invalidTokens[] = {2, 2};
+        tree = Parser__parseSpan(loadedParser, invalidTokens, 2);
+        ASSERT_NULL(tree, "Parse should fail with trailing tokens");
+
+        Parser__del(loadedParser);
+    }
+
+    ASSERT_NULL(Parser__newFromTable(map, mockRuleAction, "missing_parser_table.bin"),
+                "Parser should not be created from a missing table");
+
+    remove(path);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Create a parser over tables it does not own
+TEST(test_parser_new_from_tables)
+{
+    if (CCB_NUM_OF_PRODUCTIONS == 0 || CCB_NUM_OF_TERMINALS < 3)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    ProductionData *productions[1];
+    productions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+
+    ProductionsHashMap *map = createProductionsHashMap(productions, 1);
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    for (uint8_t k = 1; k <= 2; k++)
+    {
+        PrdcPrsnTble *prdcPrsnTble = PrdcPrsnTble__new(map, k);
+        ProductionsTable *productionsTable = ProductionsTable__new(map);
+        ASSERT_NOT_NULL(prdcPrsnTble, "Prediction table should not be NULL");
+        ASSERT_NOT_NULL(productionsTable, "Productions table should not be NULL");
+
+        // Both parsers share the tables, which must outlive them
+        for (int i = 0; i < 2; i++)
+        {
+            Parser *parser = Parser__newFromTables(prdcPrsnTble, productionsTable, mockRuleAction);
+            ASSERT_NOT_NULL(parser, "Parser should be created from the tables");
+
+            const CCB_terminal_t tokens[] = {2};
+            TreeNode *tree = Parser__parseSpan(parser, tokens, 1);
+            ASSERT_NOT_NULL(tree, "Parse should succeed with the borrowed tables");
+            TreeNode__del(tree);
+
+            Parser__del(parser);
+        }
+
+        ProductionsTable__del(productionsTable);
+        PrdcPrsnTble__del(prdcPrsnTble);
+    }
+
+    ProductionsHashMap__del(map);
+}
+
+// Test: LL(k) parsing through nullable and consecutive nonterminals
+TEST(test_parser_llk_fixpoint)
+{
+    if (CCB_NUM_OF_TERMINALS < 4)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    // S --> 'a' S S | 'b'
+    ProductionData *nestedProductions[2];
+    nestedProductions[0] = createTestProduction(0, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    nestedProductions[1] = createTestProduction(1, CCB_START_NT, 3, CCB_TERMINAL_GT);
+    ProductionData__insertRightHandGrammar(nestedProductions[0], CCB_START_NT);
+    ProductionData__insertRightHandGrammar(nestedProductions[0], CCB_START_NT);
+
+    // S --> 'a' S | ε
+    ProductionsHashMap *nullableMap = createRecursiveProductionsMap();
+    ProductionsHashMap *nestedMap = createProductionsHashMap(nestedProductions, 2);
+    ASSERT_NOT_NULL(nullableMap, "ProductionsHashMap should not be NULL");
+    ASSERT_NOT_NULL(nestedMap, "ProductionsHashMap should not be NULL");
+
+    const CCB_terminal_t as[] = {2, 2, 2};
+    const CCB_terminal_t nested[] = {2, 2, 3, 3, 3};
+    const CCB_terminal_t unbalanced[] = {2, 3};
+
+    for (uint8_t k = 1; k <= 3; k++)
+    {
+        Parser *nullableParser = Parser__new(nullableMap, mockRuleAction, k);
+        Parser *nestedParser = Parser__new(nestedMap, mockRuleAction, k);
+        ASSERT_NOT_NULL(nullableParser, "Parser of a nullable grammar should not be NULL");
+        ASSERT_NOT_NULL(nestedParser, "Parser of a nested grammar should not be NULL");
+
+        TreeNode *tree = Parser__parseSpan(nullableParser, as, 3);
+        ASSERT_NOT_NULL(tree, "Parse should end through the empty production");
+        TreeNode__del(tree);
+
+        tree = Parser__parseSpan(nestedParser, nested, 5);
+        ASSERT_NOT_NULL(tree, "Parse should succeed through consecutive nonterminals");
+        TreeNode__del(tree);
+
+        tree = Parser__parseSpan(nestedParser, unbalanced, 2);
+        ASSERT_NULL(tree, "Parse should fail when a nonterminal is missing");
+
+        Parser__del(nestedParser);
+        Parser__del(nullableParser);
+    }
+
+    ProductionsHashMap__del(nestedMap);
+    ProductionsHashMap__del(nullableMap);
+}
+
+// Test: Grammars of different sizes live side by side and share their tables with their parsers
+TEST(test_parser_grammars_side_by_side)
+{
+    if (CCB_NUM_OF_TERMINALS < 201)
+    {
+        printf("  (Skipped - grammar is too small)\n");
+        return;
+    }
+
+    // Small: S --> 'a' S | ε, Large: S --> 'z' S | 'a'
+    ProductionData *largeProductions[2];
+    largeProductions[0] = createTestProduction(0, CCB_START_NT, 200, CCB_TERMINAL_GT);
+    largeProductions[1] = createTestProduction(1, CCB_START_NT, 2, CCB_TERMINAL_GT);
+    ProductionData__insertRightHandGrammar(largeProductions[0], CCB_START_NT);
+
+    ProductionsHashMap *smallMap = createRecursiveProductionsMap();
+    ProductionsHashMap *largeMap = createProductionsHashMap(largeProductions, 2);
+    ASSERT_NOT_NULL(smallMap, "ProductionsHashMap should not be NULL");
+    ASSERT_NOT_NULL(largeMap, "ProductionsHashMap should not be NULL");
+
+    const CCB_terminal_t smallTokens[] = {2, 2, 2};
+    const CCB_terminal_t largeTokens[] = {200, 200, 2};
+
+    for (uint8_t k = 1; k <= 2; k++)
+    {
+        Grammar *smallGrammar = Grammar__new(smallMap, k);
+        Grammar *largeGrammar = Grammar__new(largeMap, k);
+        ASSERT_NOT_NULL(smallGrammar, "Small grammar should not be NULL");
+        ASSERT_NOT_NULL(largeGrammar, "Large grammar should not be NULL");
+
+        ASSERT_EQ(Grammar__getNumOfNonterminals(smallGrammar), 1, "Only START should be counted");
+        ASSERT_EQ(Grammar__getNumOfTerminals(smallGrammar), 3, "Small grammar should end at 'a'");
+        ASSERT_EQ(Grammar__getNumOfTerminals(largeGrammar), 201, "Large grammar should end at 'z'");
+        ASSERT_EQ(Grammar__getNumOfProductions(largeGrammar), 2, "Both productions should count");
+
+        Parser *smallParsers[2];
+        Parser *largeParsers[2];
+
+        for (int i = 0; i < 2; i++)
+        {
+            smallParsers[i] = Parser__newFromGrammar(smallGrammar, mockRuleAction);
+            largeParsers[i] = Parser__newFromGrammar(largeGrammar, mockRuleAction);
+            ASSERT_NOT_NULL(smallParsers[i], "Parser should be created from the small grammar");
+            ASSERT_NOT_NULL(largeParsers[i], "Parser should be created from the large grammar");
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            TreeNode *tree = Parser__parseSpan(smallParsers[i], smallTokens, 3);
+            ASSERT_NOT_NULL(tree, "Small grammar should parse its own tokens");
+            TreeNode__del(tree);
+
+            tree = Parser__parseSpan(largeParsers[i], largeTokens, 3);
+            ASSERT_NOT_NULL(tree, "Large grammar should parse its own tokens");
+            TreeNode__del(tree);
+
+            tree = Parser__parseSpan(smallParsers[i], largeTokens, 3);
+            ASSERT_NULL(tree, "Small grammar should reject terminals past its own");
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            Parser__del(smallParsers[i]);
+            Parser__del(largeParsers[i]);
+        }
+
+        Grammar__del(largeGrammar);
+        Grammar__del(smallGrammar);
+    }
+
+    ProductionsHashMap__del(largeMap);
+    ProductionsHashMap__del(smallMap);
+}
+
+// Test: Contexts share a parser without modifying it, and are reused between parses
+TEST(test_parser_context_reuse)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, mockRuleAction, 2);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    ParseContext *contexts[2];
+    contexts[0] = ParseContext__new(parser);
+    contexts[1] = ParseContext__new(parser);
+    ASSERT_NOT_NULL(contexts[0], "ParseContext should not be NULL");
+    ASSERT_NOT_NULL(contexts[1], "ParseContext should not be NULL");
+
+    CCB_terminal_t tokens[32];
+
+    for (size_t i = 0; i < 32; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    const CCB_terminal_t invalidTokens[] = {2, 3, 2};
+
+    // Failed parses leave the context ready for the next one
+    for (size_t numOfTokens = 1; numOfTokens <= 32; numOfTokens++)
+    {
+        ParseContext *context = contexts[numOfTokens % 2];
+
+        TreeNode *tree = ParseContext__parseSpan(context, tokens, numOfTokens);
+        ASSERT_NOT_NULL(tree, "Span parse should succeed");
+        TreeNode__del(tree);
+
+        ASSERT_NULL(ParseContext__parseSpan(context, invalidTokens, 3),
+                    "Span parse of an unexpected token should fail");
+
+        TokenQueue *queue = TokenQueue__new();
+        TokenQueue__enqueueMany(queue, tokens, numOfTokens);
+        tree = ParseContext__parse(context, queue);
+        ASSERT_NOT_NULL(tree, "Queue parse should succeed");
+        TreeNode__del(tree);
+        TokenQueue__del(queue);
+
+        ParseContext__begin(context);
+        ASSERT_EQ(Parser__feed(context, tokens, numOfTokens), CCB_SUCCESS,
+                  "Feeding a valid chunk should succeed");
+        tree = ParseContext__finish(context);
+        ASSERT_NOT_NULL(tree, "Push parse should succeed");
+        TreeNode__del(tree);
+        ASSERT_EQ(Parser__feed(context, tokens, 1), CCB_ERROR,
+                  "Feeding a finished parse should fail");
+    }
+
+    // An unfinished push parse is abandoned by the next parse
+    ParseContext__begin(contexts[0]);
+    ASSERT_EQ(Parser__feed(contexts[0], tokens, 5), CCB_SUCCESS,
+              "Feeding a valid chunk should succeed");
+    TreeNode *tree = ParseContext__parseSpan(contexts[0], tokens, 3);
+    ASSERT_NOT_NULL(tree, "Span parse after an abandoned one should succeed");
+    TreeNode__del(tree);
+
+    ParserStats stats;
+
+#ifdef CCB_ENABLE_STATS
+    ASSERT_EQ(ParseContext__getStats(contexts[1], &stats), CCB_SUCCESS,
+              "Getting the context stats should succeed");
+    ASSERT(stats.numOfMatches > 0, "Matches should be counted by the context");
+
+    // The parser itself is never written by its contexts
+    ASSERT_EQ(Parser__getStats(parser, &stats), CCB_SUCCESS, "Getting stats should succeed");
+    ASSERT_EQ(stats.numOfMatches, 0, "Context parses should not count into the parser");
+
+    ParseContext__resetStats(contexts[1]);
+    ASSERT_EQ(ParseContext__getStats(contexts[1], &stats), CCB_SUCCESS,
+              "Getting the context stats should succeed");
+    ASSERT_EQ(stats.numOfMatches, 0, "Reset should clear the matches");
+#else
+    ASSERT_EQ(ParseContext__getStats(contexts[1], &stats), CCB_ERROR,
+              "Getting stats should fail when they are not compiled in");
+#endif
+
+    ParseContext__del(contexts[0]);
+    ParseContext__del(contexts[1]);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Batches of inputs are parsed in several threads and returned in input order
+TEST(test_parser_parse_batch)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, countingRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    CCB_terminal_t tokens[20];
+    const CCB_terminal_t invalidTokens[] = {2, 3};
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    // Input i has i % 20 + 1 tokens, and every seventh one is invalid
+    TokenSpan inputs[300];
+    TreeNode *results[300];
+
+    for (size_t i = 0; i < 300; i++)
+    {
+        inputs[i].tokens = i % 7 == 3 ? invalidTokens : tokens;
+        inputs[i].numOfTokens = i % 7 == 3 ? 2 : i % 20 + 1;
+    }
+
+    const unsigned numsOfThreads[] = {1, 4, 0};
+
+    for (size_t run = 0; run < 3; run++)
+    {
+        int8_t result = Parser__parseBatch(parser, inputs, 300, results, NULL,
+                                           numsOfThreads[run]);
+        ASSERT_EQ(result, CCB_ERROR, "A batch with invalid inputs should fail");
+
+        for (size_t i = 0; i < 300; i++)
+        {
+            if (i % 7 == 3)
+            {
+                ASSERT_NULL(results[i], "Invalid inputs should have no tree");
+                continue;
+            }
+
+            ASSERT_NOT_NULL(results[i], "Valid inputs should have a tree");
+            ASSERT_EQ(countChildren(results[i]), i % 20 + 2,
+                      "Trees should be returned in input order");
+            TreeNode__del(results[i]);
+        }
+    }
+
+    // Only valid inputs, with more threads than inputs
+    inputs[3].tokens = tokens;
+    ASSERT_EQ(Parser__parseBatch(parser, inputs, 5, results, NULL, 8), CCB_SUCCESS,
+              "A batch of valid inputs should succeed");
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        ASSERT_NOT_NULL(results[i], "Valid inputs should have a tree");
+        TreeNode__del(results[i]);
+    }
+
+    ASSERT_EQ(Parser__parseBatch(parser, inputs, 0, results, NULL, 2), CCB_SUCCESS,
+              "An empty batch should succeed");
+
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Trees built by arena rule actions live in the arena of the context
+TEST(test_parser_arena_rule_action)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, mockRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+    Parser__setArenaRuleAction(parser, arenaRuleAction);
+
+    ParseContext *context = ParseContext__new(parser);
+    ParseArena *arena = ParseArena__new(256);
+    ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+    ASSERT_NOT_NULL(arena, "ParseArena should not be NULL");
+    ParseContext__setArena(context, arena);
+
+    CCB_terminal_t tokens[50];
+    const CCB_terminal_t invalidTokens[] = {2, 2, 3};
+
+    for (size_t i = 0; i < 50; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    for (size_t numOfTokens = 1; numOfTokens <= 50; numOfTokens++)
+    {
+        TreeNode *tree = ParseContext__parseSpan(context, tokens, numOfTokens);
+        ASSERT_NOT_NULL(tree, "Parse in the arena should succeed");
+        ASSERT_EQ(countChildren(tree), numOfTokens + 1, "Every expansion should add a child");
+        ASSERT(ParseArena__getNumOfBytes(arena) > 0, "The tree should be built in the arena");
+
+        // A failed parse leaves its nodes to the arena
+        ASSERT_NULL(ParseContext__parseSpan(context, invalidTokens, 3),
+                    "Parse of an unexpected token should fail");
+
+        ParseArena__reset(arena);
+    }
+
+    // Without an arena the same action builds trees freed with TreeNode__del
+    ParseContext__setArena(context, NULL);
+    TreeNode *tree = ParseContext__parseSpan(context, tokens, 10);
+    ASSERT_NOT_NULL(tree, "Parse without an arena should succeed");
+    ASSERT_EQ(countChildren(tree), 11, "Every expansion should add a child");
+    ASSERT_EQ(ParseArena__getNumOfBytes(arena), 0, "The arena should not be used");
+    TreeNode__del(tree);
+
+    tree = Parser__parseSpan(parser, tokens, 10);
+    ASSERT_NOT_NULL(tree, "Parse through the parser should succeed");
+    TreeNode__del(tree);
+
+    ParseArena__del(arena);
+    ParseContext__del(context);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+static int8_t failOnEmptyRuleAction(TreeNode **tree, CCB_production_t production)
+{
+    return production == 1 ? CCB_ERROR : mockRuleAction(tree, production);
+}
+
+static int8_t failOnEmptyArenaRuleAction(TreeNode **tree,
+                                         CCB_production_t production,
+                                         ParseArena *arena)
+{
+    return production == 1 ? CCB_ERROR : arenaRuleAction(tree, production, arena);
+}
+
+// Test: A failing rule action stops the parse
+TEST(test_parser_rule_action_failure)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, failOnEmptyRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    const CCB_terminal_t tokens[] = {2, 2};
+    ASSERT_NULL(Parser__parseSpan(parser, tokens, 2),
+                "Parse should fail when the rule action fails");
+
+    Parser__setArenaRuleAction(parser, failOnEmptyArenaRuleAction);
+
+    ParseContext *context = ParseContext__new(parser);
+    ParseArena *arena = ParseArena__new(256);
+    ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+    ASSERT_NOT_NULL(arena, "ParseArena should not be NULL");
+    ParseContext__setArena(context, arena);
+
+    ASSERT_NULL(ParseContext__parseSpan(context, tokens, 2),
+                "Parse should fail when the arena rule action fails");
+
+    ParseArena__del(arena);
+    ParseContext__del(context);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Batches build the trees of each thread in its own arena
+TEST(test_parser_parse_batch_arenas)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, mockRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+    Parser__setArenaRuleAction(parser, arenaRuleAction);
+
+    ParseArena *arenas[4];
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        arenas[i] = ParseArena__new(256);
+        ASSERT_NOT_NULL(arenas[i], "ParseArena should not be NULL");
+    }
+
+    CCB_terminal_t tokens[20];
+    const CCB_terminal_t invalidTokens[] = {2, 3};
+
+    for (size_t i = 0; i < 20; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    // Input i has i % 20 + 1 tokens, and every seventh one is invalid
+    TokenSpan inputs[200];
+    TreeNode *results[200];
+
+    for (size_t i = 0; i < 200; i++)
+    {
+        inputs[i].tokens = i % 7 == 3 ? invalidTokens : tokens;
+        inputs[i].numOfTokens = i % 7 == 3 ? 2 : i % 20 + 1;
+    }
+
+    ASSERT_EQ(Parser__parseBatch(parser, inputs, 200, results, arenas, 4), CCB_ERROR,
+              "A batch with invalid inputs should fail");
+
+    size_t numOfBytes = 0;
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        numOfBytes += ParseArena__getNumOfBytes(arenas[i]);
+    }
+
+    ASSERT(numOfBytes > 0, "The trees should be built in the arenas");
+
+    for (size_t i = 0; i < 200; i++)
+    {
+        if (i % 7 == 3)
+        {
+            ASSERT_NULL(results[i], "Invalid inputs should have no tree");
+            continue;
+        }
+
+        // Released with the arenas rather than with TreeNode__del
+        ASSERT_NOT_NULL(results[i], "Valid inputs should have a tree");
+        ASSERT_EQ(countChildren(results[i]), i % 20 + 2,
+                  "Trees should be returned in input order");
+    }
+
+    ASSERT_EQ(Parser__parseBatch(parser, inputs, 200, results, arenas, 0), CCB_ERROR,
+              "Arenas should need a number of threads");
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        ParseArena__del(arenas[i]);
+    }
+
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Listener recording the events of a parse, and stopping it after `stopAfter` events if set
+typedef struct EventLog
+{
+    char kinds[64];
+    size_t values[64];
+    size_t numOfEvents;
+    size_t stopAfter;
+} EventLog;
+
+static int8_t sEventLog__add(EventLog *log, char kind, size_t value)
+{
+    if (log->numOfEvents == 64 || (log->stopAfter > 0 && log->numOfEvents == log->stopAfter))
+    {
+        return CCB_ERROR;
+    }
+
+    log->kinds[log->numOfEvents] = kind;
+    log->values[log->numOfEvents] = value;
+    log->numOfEvents++;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t onEnterLogged(void *context, CCB_production_t production)
+{
+    return sEventLog__add(context, 'E', production);
+}
+
+static int8_t onTokenLogged(void *context, CCB_terminal_t terminal, size_t position)
+{
+    return sEventLog__add(context, 'T', terminal * 100 + position);
+}
+
+static int8_t onExitLogged(void *context, CCB_production_t production)
+{
+    return sEventLog__add(context, 'X', production);
+}
+
+// Test: Parse events are streamed to a listener without building a tree
+TEST(test_parser_listener_events)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, NULL, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    ParseContext *context = ParseContext__new(parser);
+    ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_ERROR, "No parse should have ended yet");
+
+    EventLog log = {0};
+    ParseListener listener = {onEnterLogged, onTokenLogged, onExitLogged, &log};
+    ParseContext__setListener(context, &listener);
+
+    // Preorder walk of START(2, START(2, START()))
+    const CCB_terminal_t tokens[] = {2, 2};
+    const char expectedKinds[] = "ETETEXXX";
+    const size_t expectedValues[] = {0, 200, 0, 201, 1, 1, 0, 0};
+
+    ASSERT_NULL(ParseContext__parseSpan(context, tokens, 2), "No tree should be built");
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_SUCCESS, "Parse should succeed");
+    ASSERT_EQ(log.numOfEvents, 8, "Every event should be sent");
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        ASSERT_EQ(log.kinds[i], expectedKinds[i], "Events should come in preorder");
+        ASSERT_EQ(log.values[i], expectedValues[i], "Events should carry their grammar");
+    }
+
+    // Pushed one token at a time, the parse sends the same events
+    log.numOfEvents = 0;
+    ParseContext__begin(context);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        ASSERT_EQ(Parser__feed(context, &tokens[i], 1), CCB_SUCCESS,
+                  "Feeding a valid chunk should succeed");
+    }
+
+    ASSERT_NULL(ParseContext__finish(context), "No tree should be built");
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_SUCCESS, "Push parse should succeed");
+    ASSERT_EQ(log.numOfEvents, 8, "Every event should be sent");
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        ASSERT_EQ(log.kinds[i], expectedKinds[i], "Events should come in preorder");
+        ASSERT_EQ(log.values[i], expectedValues[i], "Events should carry their grammar");
+    }
+
+    // A callback failing stops the parse
+    log.numOfEvents = 0;
+    log.stopAfter = 3;
+    ASSERT_NULL(ParseContext__parseSpan(context, tokens, 2), "Stopped parse should fail");
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_ERROR, "Stopped parse should fail");
+    ASSERT_EQ(log.numOfEvents, 3, "No event should follow the failing one");
+
+    // Parses with a rule action still build their tree, and stop sending events without listener
+    Parser *treeParser = Parser__new(map, countingRuleAction, 1);
+    ParseContext *treeContext = ParseContext__new(treeParser);
+    ASSERT_NOT_NULL(treeContext, "ParseContext should not be NULL");
+
+    log.numOfEvents = 0;
+    log.stopAfter = 0;
+    ParseContext__setListener(treeContext, &listener);
+    TreeNode *tree = ParseContext__parseSpan(treeContext, tokens, 2);
+    ASSERT_NOT_NULL(tree, "Parse with a listener should build the tree");
+    ASSERT_EQ(countChildren(tree), 3, "Every expansion should add a child");
+    ASSERT_EQ(log.numOfEvents, 8, "Every event should be sent");
+    TreeNode__del(tree);
+
+    ParseContext__setListener(treeContext, NULL);
+    tree = ParseContext__parseSpan(treeContext, tokens, 2);
+    ASSERT_NOT_NULL(tree, "Parse without a listener should succeed");
+    ASSERT_EQ(log.numOfEvents, 8, "No event should be sent without a listener");
+    TreeNode__del(tree);
+
+    ParseContext__del(treeContext);
+    Parser__del(treeParser);
+    ParseContext__del(context);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Test: Parses fill a concrete syntax tree in preorder without a rule action
+TEST(test_parser_syntax_tree)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, NULL, 1);
+    ParseContext *context = parser == NULL ? NULL : ParseContext__new(parser);
+    ConcreteSyntaxTree *syntaxTree = ConcreteSyntaxTree__new(1);
+    ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+    ASSERT_NOT_NULL(syntaxTree, "ConcreteSyntaxTree should not be NULL");
+    ParseContext__setSyntaxTree(context, syntaxTree);
+
+    // START(2, START(2, START())), one parse after the other into the same tree
+    const CCB_terminal_t tokens[] = {2, 2};
+    const CCB_production_t expectedProductions[] = {0, CCB_ERROR_PR, 0, CCB_ERROR_PR, 1};
+    const CCB_terminal_t expectedTerminals[] = {CCB_EMPTY_STRING_TR, 2, CCB_EMPTY_STRING_TR, 2,
+                                                CCB_EMPTY_STRING_TR};
+    const size_t expectedParents[] = {CCB_NO_NODE, 0, 0, 2, 2};
+    const size_t expectedFirstChildren[] = {1, CCB_NO_NODE, 3, CCB_NO_NODE, CCB_NO_NODE};
+    const size_t expectedNextSiblings[] = {CCB_NO_NODE, 2, CCB_NO_NODE, 4, CCB_NO_NODE};
+    const size_t expectedTokenStarts[] = {0, 0, 1, 1, 2};
+    const size_t expectedTokenEnds[] = {2, 1, 2, 2, 2};
+
+    for (size_t repeat = 0; repeat < 2; repeat++)
+    {
+        ASSERT_NULL(ParseContext__parseSpan(context, tokens, 2), "No tree should be built");
+        ASSERT_EQ(ParseContext__getStatus(context), CCB_SUCCESS, "Parse should succeed");
+        ASSERT_EQ(syntaxTree->numOfNodes, 5, "Every expansion and match should add a node");
+
+        for (size_t node = 0; node < 5; node++)
+        {
+            ASSERT_EQ(syntaxTree->productions[node], expectedProductions[node],
+                      "Nodes should keep their production");
+            ASSERT_EQ(syntaxTree->terminals[node], expectedTerminals[node],
+                      "Nodes should keep their terminal");
+            ASSERT_EQ(syntaxTree->parents[node], expectedParents[node],
+                      "Nodes should point to their parent");
+            ASSERT_EQ(syntaxTree->firstChildren[node], expectedFirstChildren[node],
+                      "Nodes should point to their first child");
+            ASSERT_EQ(syntaxTree->nextSiblings[node], expectedNextSiblings[node],
+                      "Nodes should point to their next sibling");
+            ASSERT_EQ(syntaxTree->tokenStarts[node], expectedTokenStarts[node],
+                      "Nodes should start at their first token");
+            ASSERT_EQ(syntaxTree->tokenEnds[node], expectedTokenEnds[node],
+                      "Nodes should end after their last token");
+        }
+    }
+
+    // Long inputs grow the tree, and a failed parse leaves the nodes reached so far
+    CCB_terminal_t longTokens[1000];
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        longTokens[i] = 2;
+    }
+
+    ParseContext__parseSpan(context, longTokens, 1000);
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_SUCCESS, "Long parse should succeed");
+    ASSERT_EQ(syntaxTree->numOfNodes, 2001, "Every expansion and match should add a node");
+    ASSERT_EQ(syntaxTree->tokenEnds[0], 1000, "Root should span the whole input");
+
+    longTokens[500] = 3;
+    ParseContext__parseSpan(context, longTokens, 1000);
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_ERROR,
+              "Parse of an unexpected token should fail");
+    ASSERT(syntaxTree->numOfNodes < 2001, "Failed parse should stop adding nodes");
+
+    // Without a syntax tree the next parses leave it alone
+    ParseContext__setSyntaxTree(context, NULL);
+    ParseContext__parseSpan(context, tokens, 2);
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_SUCCESS, "Parse should succeed");
+    ASSERT(syntaxTree->numOfNodes > 5, "Syntax tree should not be filled");
+
+    ConcreteSyntaxTree__del(syntaxTree);
+    ParseContext__del(context);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Production actions keeping the path from the root to the node being built
+typedef struct ActionPath
+{
+    TreeNode *nodes[64];
+    size_t depth;
+    size_t numOfExits;
+    size_t maxDepth;
+} ActionPath;
+
+static int8_t onEnterNested(TreeNode **tree, CCB_production_t production, void *context)
+{
+    ActionPath *path = context;
+
+    if (path->depth == path->maxDepth)
+    {
+        return CCB_ERROR;
+    }
+
+    TreeNode *node = TreeNode__new(&production, sizeof(CCB_production_t));
+
+    if (*tree == NULL)
+    {
+        *tree = node;
+    }
+    else
+    {
+        TreeNode__insert(path->nodes[path->depth - 1], node);
+    }
+
+    path->nodes[path->depth++] = node;
+
+    return CCB_SUCCESS;
+}
+
+static int8_t onExitNested(TreeNode **tree, CCB_production_t production, void *context)
+{
+    ActionPath *path = context;
+    path->depth--;
+    path->numOfExits++;
+
+    return CCB_SUCCESS;
+}
+
+static size_t sNumOfCountedExits = 0;
+
+static int8_t countingExit(TreeNode **tree, CCB_production_t production, void *context)
+{
+    sNumOfCountedExits++;
+
+    return context == NULL ? CCB_SUCCESS : CCB_ERROR;
+}
+
+// Test: Production actions are dispatched by production id on entry and exit
+TEST(test_parser_production_actions)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, mockRuleAction, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+
+    // P1 has no hooks, so its expansions call nothing
+    const ProductionActions actions[] = {
+        {onEnterNested, onExitNested},
+        {NULL, NULL},
+        {NULL, NULL},
+    };
+    ASSERT_EQ(Parser__setProductionActions(parser, actions, 3), CCB_ERROR,
+              "More actions than productions should fail");
+    ASSERT_EQ(Parser__setProductionActions(parser, actions, 1), CCB_SUCCESS,
+              "Setting the production actions should succeed");
+
+    ParseContext *context = ParseContext__new(parser);
+    ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+
+    ActionPath path = {.maxDepth = 64};
+    ParseContext__setActionContext(context, &path);
+
+    CCB_terminal_t tokens[10];
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        tokens[i] = 2;
+    }
+
+    // The exit hooks close each node, so the chain of P0 nodes is built without rebuilding
+    TreeNode *tree = ParseContext__parseSpan(context, tokens, 10);
+    ASSERT_NOT_NULL(tree, "Parse with production actions should succeed");
+    ASSERT_EQ(path.depth, 0, "Every entered production should be exited");
+    ASSERT_EQ(path.numOfExits, 10, "Every P0 expansion should be exited once");
+
+    size_t depth = 0;
+
+    for (TreeNode *node = tree;
+         node != NULL;
+         node = node->childrenHead == NULL ? NULL : node->childrenHead->value)
+    {
+        ASSERT_EQ(*(CCB_production_t *)node->value, 0, "Only P0 should have a node");
+        depth++;
+    }
+
+    ASSERT_EQ(depth, 10, "Every P0 expansion should nest in the previous one");
+    TreeNode__del(tree);
+
+    // Parses through the parser run the hooks too, with a NULL context
+    Parser *countingParser = Parser__new(map, NULL, 1);
+    const ProductionActions countingActions[] = {{NULL, countingExit}};
+    ASSERT_EQ(Parser__setProductionActions(countingParser, countingActions, 1), CCB_SUCCESS,
+              "Setting the production actions should succeed");
+    sNumOfCountedExits = 0;
+    ASSERT_NULL(Parser__parseSpan(countingParser, tokens, 10), "No hook should build a tree");
+    ASSERT_EQ(sNumOfCountedExits, 10, "Every P0 expansion should be exited once");
+    Parser__del(countingParser);
+
+    // A failing hook stops the parse
+    path.maxDepth = 3;
+    path.depth = 0;
+    ASSERT_NULL(ParseContext__parseSpan(context, tokens, 10),
+                "Failing action should fail the parse");
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_ERROR, "Failing action should fail the parse");
+
+    ParseContext__del(context);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
+
+// Token action building a leaf that keeps the token record instead of a copy of its lexeme
+static int8_t recordLeafAction(TreeNode **tree, const TokenRecord *token, void *context)
+{
+    if (*tree == NULL)
+    {
+        *tree = TreeNode__new(NULL, 0);
+    }
+
+    return TreeNode__insert(*tree, TreeNode__new((void *)token, sizeof(TokenRecord)));
+}
+
+// Test: Token records reach the token action and index the syntax tree without copying lexemes
+TEST(test_parser_token_records)
+{
+    ProductionsHashMap *map = createRecursiveProductionsMap();
+    ASSERT_NOT_NULL(map, "ProductionsHashMap should not be NULL");
+
+    Parser *parser = Parser__new(map, NULL, 1);
+    ASSERT_NOT_NULL(parser, "Parser should not be NULL");
+    Parser__setTokenAction(parser, recordLeafAction);
+
+    const char *source = "x yy zzz";
+    const TokenRecord records[] = {{2, 0, 1}, {2, 2, 2}, {2, 5, 3}};
+    const char *lexemes[] = {"x", "yy", "zzz"};
+
+    TreeNode *tree = Parser__parseRecords(parser, records, 3);
+    ASSERT_NOT_NULL(tree, "Parse of token records should succeed");
+    ASSERT_EQ(countChildren(tree), 3, "Every matched token should add a leaf");
+
+    size_t position = 0;
+
+    for (SinglyLinkedListNode *link = tree->childrenHead; link != NULL; link = link->next)
+    {
+        const TokenRecord *leaf = ((TreeNode *)link->value)->value;
+        ASSERT_EQ(leaf->offset, records[position].offset, "Leaves should keep the offset");
+        ASSERT_EQ(leaf->length, records[position].length, "Leaves should keep the length");
+        ASSERT(strncmp(source + leaf->offset, lexemes[position], leaf->length) == 0,
+               "Leaves should point to their lexeme in the source");
+        position++;
+    }
+
+    TreeNode__del(tree);
+
+    // Other inputs pass records with the terminal and an empty lexeme
+    const CCB_terminal_t tokens[] = {2, 2};
+    tree = Parser__parseSpan(parser, tokens, 2);
+    ASSERT_NOT_NULL(tree, "Parse of a span should succeed");
+    ASSERT_EQ(countChildren(tree), 2, "Every matched token should add a leaf");
+    const TokenRecord *leaf = ((TreeNode *)tree->childrenHead->value)->value;
+    ASSERT_EQ(leaf->terminal, 2, "Leaves should keep the terminal");
+    ASSERT_EQ(leaf->length, 0, "Leaves of spans should have empty lexemes");
+    TreeNode__del(tree);
+
+    // The terminal nodes of a syntax tree index the records
+    Parser__setTokenAction(parser, NULL);
+    ParseContext *context = ParseContext__new(parser);
+    ConcreteSyntaxTree *syntaxTree = ConcreteSyntaxTree__new(0);
+    ASSERT_NOT_NULL(context, "ParseContext should not be NULL");
+    ASSERT_NOT_NULL(syntaxTree, "ConcreteSyntaxTree should not be NULL");
+    ParseContext__setSyntaxTree(context, syntaxTree);
+
+    ParseContext__parseRecords(context, records, 3);
+    ASSERT_EQ(ParseContext__getStatus(context), CCB_SUCCESS,
+              "Parse of token records should succeed");
+
+    position = 0;
+
+    for (size_t node = 0; node < syntaxTree->numOfNodes; node++)
+    {
+        if (syntaxTree->productions[node] == CCB_ERROR_PR)
+        {
+            const TokenRecord *record = &records[syntaxTree->tokenStarts[node]];
+            ASSERT(strncmp(source + record->offset, lexemes[position], record->length) == 0,
+                   "Terminal nodes should reach their lexeme through the records");
+            position++;
+        }
+    }
+
+    ASSERT_EQ(position, 3, "Every matched token should have a terminal node");
+
+    const TokenRecord invalidRecords[] = {{2, 0, 1}, {3, 2, 2}};
+    ASSERT_NULL(ParseContext__parseRecords(context, invalidRecords, 2),
+                "Parse of an unexpected token should fail");
+
+    ConcreteSyntaxTree__del(syntaxTree);
+    ParseContext__del(context);
+    Parser__del(parser);
+    ProductionsHashMap__del(map);
+}
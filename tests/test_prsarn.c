@@ -0,0 +1,125 @@
+#include <stdint.h>
+#include <string.h>
+#include <cbarroso/tree.h>
+#include <ccabral/prsarn.h>
+#include <ccabral/constants.h>
+#include <ccauchy.h>
+
+// Test: Create a new ParseArena
+TEST(test_prsarn_new)
+{
+    ParseArena *arena = ParseArena__new(0);
+    ASSERT_NOT_NULL(arena, "ParseArena should not be NULL");
+    ASSERT_EQ(ParseArena__getNumOfBytes(arena), 0, "New arena should be empty");
+
+    ParseArena__del(arena);
+}
+
+// Test: Allocations are aligned and do not overlap, even past the first block
+TEST(test_prsarn_alloc)
+{
+    ParseArena *arena = ParseArena__new(64);
+    ASSERT_NOT_NULL(arena, "ParseArena should not be NULL");
+
+    unsigned char *previous = NULL;
+
+    for (size_t size = 1; size <= 200; size++)
+    {
+        unsigned char *bytes = ParseArena__alloc(arena, size);
+        ASSERT_NOT_NULL(bytes, "Allocation should succeed");
+        ASSERT_EQ((uintptr_t)bytes % sizeof(void *), 0, "Allocation should be aligned");
+
+        memset(bytes, (int)size, size);
+
+        if (previous != NULL)
+        {
+            ASSERT_EQ(previous[0], (unsigned char)(size - 1),
+                      "Allocation should not overwrite the previous one");
+        }
+
+        previous = bytes;
+    }
+
+    ASSERT_EQ(ParseArena__getNumOfBytes(arena), 200 * 201 / 2, "Every byte should be counted");
+
+    // A single allocation larger than any block
+    unsigned char *large = ParseArena__alloc(arena, 100000);
+    ASSERT_NOT_NULL(large, "Large allocation should succeed");
+    memset(large, 0xAB, 100000);
+
+    ParseArena__del(arena);
+}
+
+// Test: Reset releases everything and reuses the blocks
+TEST(test_prsarn_reset)
+{
+    ParseArena *arena = ParseArena__new(128);
+    ASSERT_NOT_NULL(arena, "ParseArena should not be NULL");
+
+    void *first = ParseArena__alloc(arena, 16);
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        ASSERT_NOT_NULL(ParseArena__alloc(arena, 48), "Allocation should succeed");
+    }
+
+    ParseArena__reset(arena);
+    ASSERT_EQ(ParseArena__getNumOfBytes(arena), 0, "Reset arena should be empty");
+    ASSERT(ParseArena__alloc(arena, 16) == first, "Reset arena should start over its first block");
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        ASSERT_NOT_NULL(ParseArena__alloc(arena, 48), "Allocation should succeed after reset");
+    }
+
+    ParseArena__del(arena);
+}
+
+// Test: Tree nodes built in the arena keep their values and children in order
+TEST(test_prsarn_tree_nodes)
+{
+    ParseArena *arena = ParseArena__new(256);
+    ASSERT_NOT_NULL(arena, "ParseArena should not be NULL");
+
+    int rootValue = 7;
+    TreeNode *root = ParseArena__newTreeNode(arena, &rootValue, sizeof(int));
+    ASSERT_NOT_NULL(root, "Root should not be NULL");
+    ASSERT_EQ(*(int *)root->value, 7, "Root value should be copied");
+    ASSERT_NULL(root->childrenHead, "Root should have no children");
+
+    TreeNode *other = ParseArena__newTreeNode(arena, NULL, 0);
+    ASSERT_NOT_NULL(other, "Node without a value should not be NULL");
+    ASSERT_NULL(other->value, "Node without a value should have no value");
+
+    for (int i = 0; i < 100; i++)
+    {
+        TreeNode *child = ParseArena__newTreeNode(arena, &i, sizeof(int));
+        ASSERT_EQ(ParseArena__insertTreeNode(arena, root, child), CCB_SUCCESS,
+                  "Insert should succeed");
+
+        // Interleaved inserts into another node
+        ASSERT_EQ(ParseArena__insertTreeNode(arena, other, ParseArena__newTreeNode(arena, NULL, 0)),
+                  CCB_SUCCESS, "Insert should succeed");
+    }
+
+    int expected = 0;
+
+    for (SinglyLinkedListNode *link = root->childrenHead; link != NULL; link = link->next)
+    {
+        ASSERT_EQ(*(int *)((TreeNode *)link->value)->value, expected,
+                  "Children should be kept in insertion order");
+        expected++;
+    }
+
+    ASSERT_EQ(expected, 100, "Every child should be inserted");
+
+    // Without an arena, nodes come from TreeNode__new
+    TreeNode *heapRoot = ParseArena__newTreeNode(NULL, &rootValue, sizeof(int));
+    ASSERT_NOT_NULL(heapRoot, "Heap root should not be NULL");
+    ASSERT_EQ(ParseArena__insertTreeNode(NULL, heapRoot, ParseArena__newTreeNode(NULL, NULL, 0)),
+              CCB_SUCCESS, "Heap insert should succeed");
+    ASSERT_NOT_NULL(heapRoot->childrenHead, "Heap root should have a child");
+    TreeNode__del(heapRoot);
+
+    ParseArena__del(arena);
+}
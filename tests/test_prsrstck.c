@@ -2,48 +2,52 @@
 #include <ccabral/constants.h>
 #include <ccauchy.h>
 
+// Helper function to create a parser stack without the end of text terminal
+static ParserStack *createEmptyStack()
+{
+    return calloc(1, sizeof(ParserStack));
+}
+
 // Test: Create a new ParserStack
 TEST(test_prsrstck_new)
 {
     ParserStack *stack = ParserStack__new();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
     ASSERT_EQ(stack->stackSize, 1, "ParserStack should have 1 element (EOT)");
-    ASSERT_NOT_NULL(stack->top, "ParserStack top should not be NULL");
+    ASSERT_NOT_NULL(stack->grammars, "ParserStack grammars should not be NULL");
     
     // Verify that CCB_END_OF_TEXT_TR was pushed
-    GrammarData *data;
+    GrammarData data;
     int8_t result = ParserStack__pop(stack, &data);
     ASSERT_EQ(result, CCB_SUCCESS, "Pop should succeed");
-    ASSERT_EQ(data->id, CCB_END_OF_TEXT_TR, "First element should be CCB_END_OF_TEXT_TR");
-    ASSERT_EQ(data->type, CCB_TERMINAL_GT, "Type should be CCB_TERMINAL_GT");
+    ASSERT_EQ(data.id, CCB_END_OF_TEXT_TR, "First element should be CCB_END_OF_TEXT_TR");
+    ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Type should be CCB_TERMINAL_GT");
     
-    free(data);
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Push single grammar symbol
 TEST(test_prsrstck_push_single)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     CCB_grammar_t grammar_id = 5;
     int8_t result = ParserStack__push(stack, grammar_id, CCB_NONTERMINAL_GT);
     ASSERT_EQ(result, CCB_SUCCESS, "Push should return CCB_SUCCESS");
     ASSERT_EQ(stack->stackSize, 1, "Stack size should be 1");
-    ASSERT_NOT_NULL(stack->top, "Stack top should not be NULL");
+    ASSERT_NOT_NULL(stack->grammars, "Stack grammars should not be NULL");
 
     // Cleanup
-    GrammarData *data;
+    GrammarData data;
     ParserStack__pop(stack, &data);
-    free(data);
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Push multiple grammar symbols
 TEST(test_prsrstck_push_multiple)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     for (CCB_grammar_t i = 0; i < 10; i++)
@@ -57,52 +61,50 @@ TEST(test_prsrstck_push_multiple)
     ASSERT_EQ(stack->stackSize, 10, "Stack size should be 10");
 
     // Cleanup
-    GrammarData *data;
+    GrammarData data;
     while (stack->stackSize > 0)
     {
         ParserStack__pop(stack, &data);
-        free(data);
     }
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Pop single grammar symbol
 TEST(test_prsrstck_pop_single)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     CCB_grammar_t grammar_id = 42;
     ParserStack__push(stack, grammar_id, CCB_TERMINAL_GT);
 
-    GrammarData *data;
+    GrammarData data;
     int8_t result = ParserStack__pop(stack, &data);
     ASSERT_EQ(result, CCB_SUCCESS, "Pop should return CCB_SUCCESS");
-    ASSERT_EQ(data->id, grammar_id, "Popped grammar id should match pushed value");
-    ASSERT_EQ(data->type, CCB_TERMINAL_GT, "Popped type should be CCB_TERMINAL_GT");
+    ASSERT_EQ(data.id, grammar_id, "Popped grammar id should match pushed value");
+    ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Popped type should be CCB_TERMINAL_GT");
     ASSERT_EQ(stack->stackSize, 0, "Stack should be empty after pop");
 
-    free(data);
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Pop from empty stack
 TEST(test_prsrstck_pop_empty)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
-    GrammarData *data;
+    GrammarData data;
     int8_t result = ParserStack__pop(stack, &data);
     ASSERT_EQ(result, CCB_ERROR, "Pop from empty stack should return CCB_ERROR");
 
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: LIFO order
 TEST(test_prsrstck_lifo_order)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     CCB_grammar_t grammar_ids[] = {1, 2, 3, 4, 5};
@@ -119,62 +121,58 @@ TEST(test_prsrstck_lifo_order)
     // Pop and verify LIFO order
     for (int i = count - 1; i >= 0; i--)
     {
-        GrammarData *data;
+        GrammarData data;
         int8_t result = ParserStack__pop(stack, &data);
         ASSERT_EQ(result, CCB_SUCCESS, "Pop should succeed");
-        ASSERT_EQ(data->id, grammar_ids[i], "Grammar id should match LIFO order");
-        ASSERT_EQ(data->type, types[i], "Type should match LIFO order");
-        free(data);
+        ASSERT_EQ(data.id, grammar_ids[i], "Grammar id should match LIFO order");
+        ASSERT_EQ(data.type, types[i], "Type should match LIFO order");
     }
 
     ASSERT_EQ(stack->stackSize, 0, "Stack should be empty");
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Push nonterminals
 TEST(test_prsrstck_push_nonterminals)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     ParserStack__push(stack, CCB_START_NT, CCB_NONTERMINAL_GT);
     
-    GrammarData *data;
+    GrammarData data;
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, CCB_START_NT, "Should be CCB_START_NT");
-    ASSERT_EQ(data->type, CCB_NONTERMINAL_GT, "Should be nonterminal type");
+    ASSERT_EQ(data.id, CCB_START_NT, "Should be CCB_START_NT");
+    ASSERT_EQ(data.type, CCB_NONTERMINAL_GT, "Should be nonterminal type");
 
-    free(data);
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Push terminals
 TEST(test_prsrstck_push_terminals)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     ParserStack__push(stack, CCB_EMPTY_STRING_TR, CCB_TERMINAL_GT);
     ParserStack__push(stack, CCB_END_OF_TEXT_TR, CCB_TERMINAL_GT);
     
-    GrammarData *data;
+    GrammarData data;
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, CCB_END_OF_TEXT_TR, "Should be CCB_END_OF_TEXT_TR");
-    ASSERT_EQ(data->type, CCB_TERMINAL_GT, "Should be terminal type");
-    free(data);
+    ASSERT_EQ(data.id, CCB_END_OF_TEXT_TR, "Should be CCB_END_OF_TEXT_TR");
+    ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Should be terminal type");
     
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, CCB_EMPTY_STRING_TR, "Should be CCB_EMPTY_STRING_TR");
-    ASSERT_EQ(data->type, CCB_TERMINAL_GT, "Should be terminal type");
-    free(data);
+    ASSERT_EQ(data.id, CCB_EMPTY_STRING_TR, "Should be CCB_EMPTY_STRING_TR");
+    ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Should be terminal type");
 
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Mixed operations
 TEST(test_prsrstck_mixed_operations)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     // Push some values
@@ -184,14 +182,12 @@ TEST(test_prsrstck_mixed_operations)
     }
 
     // Pop some values
-    GrammarData *data;
+    GrammarData data;
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, 4, "First pop should return 4");
-    free(data);
+    ASSERT_EQ(data.id, 4, "First pop should return 4");
     
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, 3, "Second pop should return 3");
-    free(data);
+    ASSERT_EQ(data.id, 3, "Second pop should return 3");
 
     // Push more values
     ParserStack__push(stack, 10, CCB_TERMINAL_GT);
@@ -204,15 +200,14 @@ TEST(test_prsrstck_mixed_operations)
     while (stack->stackSize > 0)
     {
         ParserStack__pop(stack, &data);
-        free(data);
     }
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Large number of operations
 TEST(test_prsrstck_large_operations)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     size_t large_count = 100;
@@ -230,40 +225,100 @@ TEST(test_prsrstck_large_operations)
     // Pop all values
     for (int i = large_count - 1; i >= 0; i--)
     {
-        GrammarData *data;
+        GrammarData data;
         int8_t result = ParserStack__pop(stack, &data);
         ASSERT_EQ(result, CCB_SUCCESS, "Pop should succeed");
-        ASSERT_EQ(data->id, (CCB_grammar_t)i, "Value should match");
-        free(data);
+        ASSERT_EQ(data.id, (CCB_grammar_t)i, "Value should match");
     }
 
     ASSERT_EQ(stack->stackSize, 0, "Stack should be empty");
-    free(stack);
+    ParserStack__del(stack);
 }
 
 // Test: Verify GrammarData structure
 TEST(test_prsrstck_grammar_data)
 {
-    ParserStack *stack = Stack__new();
+    ParserStack *stack = createEmptyStack();
     ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
 
     // Push different types of grammar symbols
     ParserStack__push(stack, 10, CCB_TERMINAL_GT);
     ParserStack__push(stack, 20, CCB_NONTERMINAL_GT);
 
-    GrammarData *data;
+    GrammarData data;
     
     // Check nonterminal
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, 20, "Grammar id should be 20");
-    ASSERT_EQ(data->type, CCB_NONTERMINAL_GT, "Type should be nonterminal");
-    free(data);
+    ASSERT_EQ(data.id, 20, "Grammar id should be 20");
+    ASSERT_EQ(data.type, CCB_NONTERMINAL_GT, "Type should be nonterminal");
 
     // Check terminal
     ParserStack__pop(stack, &data);
-    ASSERT_EQ(data->id, 10, "Grammar id should be 10");
-    ASSERT_EQ(data->type, CCB_TERMINAL_GT, "Type should be terminal");
-    free(data);
+    ASSERT_EQ(data.id, 10, "Grammar id should be 10");
+    ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Type should be terminal");
+
+    ParserStack__del(stack);
+}
+
+// Test: Push a run of grammars at once
+TEST(test_prsrstck_push_many)
+{
+    ParserStack *stack = createEmptyStack();
+    ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
+
+    GrammarData grammars[] = {{1, CCB_TERMINAL_GT},
+                              {2, CCB_NONTERMINAL_GT},
+                              {3, CCB_TERMINAL_GT}};
+
+    int8_t result = ParserStack__pushMany(stack, grammars, 3);
+    ASSERT_EQ(result, CCB_SUCCESS, "Push many should succeed");
+    ASSERT_EQ(stack->stackSize, 3, "Stack size should be 3");
+
+    GrammarData data;
+    ParserStack__pop(stack, &data);
+    ASSERT_EQ(data.id, 3, "Last pushed grammar should be on top");
+    ASSERT_EQ(data.type, CCB_TERMINAL_GT, "Type should be terminal");
+
+    ParserStack__pop(stack, &data);
+    ASSERT_EQ(data.id, 2, "Second grammar should be next");
+    ASSERT_EQ(data.type, CCB_NONTERMINAL_GT, "Type should be nonterminal");
+
+    result = ParserStack__pushMany(stack, grammars, 0);
+    ASSERT_EQ(result, CCB_SUCCESS, "Pushing nothing should succeed");
+    ASSERT_EQ(stack->stackSize, 1, "Stack size should be unchanged");
+
+    ParserStack__del(stack);
+}
+
+// Test: Grammars are as wide as the widest configured id and keep it through the stack
+TEST(test_prsrstck_grammar_width)
+{
+    size_t terminalBits = sizeof(CCB_terminal_t) * 8;
+    size_t nonterminalBits = sizeof(CCB_nonterminal_t) * 8;
+
+    ASSERT_EQ(terminalBits, CCB_TERMINAL_BITS, "Terminals should have the configured width");
+    ASSERT_EQ(nonterminalBits, CCB_NONTERMINAL_BITS, "Nonterminals should have the configured width");
+    ASSERT_EQ(sizeof(CCB_production_t) * 8, CCB_PRODUCTION_BITS, "Productions should have the configured width");
+    ASSERT_EQ(sizeof(CCB_grammar_t) * 8,
+              terminalBits > nonterminalBits ? terminalBits : nonterminalBits,
+              "Grammars should be as wide as the widest id");
+    ASSERT(CCB_ERROR_PR < 0, "Productions should be signed");
+
+    ParserStack *stack = createEmptyStack();
+    ASSERT_NOT_NULL(stack, "ParserStack should not be NULL");
+
+    CCB_terminal_t maxTerminal = (CCB_terminal_t)-1;
+    CCB_nonterminal_t maxNonterminal = (CCB_nonterminal_t)-1;
+
+    ParserStack__push(stack, maxTerminal, CCB_TERMINAL_GT);
+    ParserStack__push(stack, maxNonterminal, CCB_NONTERMINAL_GT);
+
+    GrammarData data;
+    ParserStack__pop(stack, &data);
+    ASSERT_EQ(data.id, maxNonterminal, "Widest nonterminal should not be truncated");
+
+    ParserStack__pop(stack, &data);
+    ASSERT_EQ(data.id, maxTerminal, "Widest terminal should not be truncated");
 
-    free(stack);
+    ParserStack__del(stack);
 }
@@ -10,6 +10,18 @@ void test_tknsq_fifo_order(void);
 void test_tknsq_mixed_operations(void);
 void test_tknsq_large_operations(void);
 void test_tknsq_boundary_values(void);
+void test_tknsq_bulk_operations(void);
+void test_tknsq_bulk_wraparound(void);
+
+// Forward declarations for ParseArena tests
+void test_prsarn_new(void);
+void test_prsarn_alloc(void);
+void test_prsarn_reset(void);
+void test_prsarn_tree_nodes(void);
+
+// Forward declarations for ConcreteSyntaxTree tests
+void test_cst_new(void);
+void test_cst_add_node(void);
 
 // Forward declarations for ParserStack tests
 void test_prsrstck_new(void);
@@ -23,6 +35,8 @@ void test_prsrstck_push_terminals(void);
 void test_prsrstck_mixed_operations(void);
 void test_prsrstck_large_operations(void);
 void test_prsrstck_grammar_data(void);
+void test_prsrstck_push_many(void);
+void test_prsrstck_grammar_width(void);
 
 // Forward declarations for auxiliary data structure tests
 void test_auxds_grammar_data(void);
@@ -32,10 +46,19 @@ void test_auxds_add_terminal_to_entry(void);
 void test_auxds_build_first_simple(void);
 void test_auxds_build_first_allocation(void);
 void test_auxds_build_follow_simple(void);
+void test_auxds_build_first_follow_fixpoint(void);
+void test_auxds_build_first_follow_terminal_sets(void);
 void test_auxds_build_parse_table(void);
+void test_auxds_parse_table_ll1_lookup(void);
+void test_auxds_parse_table_llk_trie(void);
+void test_auxds_parse_table_ll2_prediction(void);
+void test_auxds_parse_table_save_load(void);
 void test_auxds_destroy_first_follow(void);
 void test_auxds_grammar_types(void);
 void test_auxds_production_multiple_symbols(void);
+void test_auxds_productions_table(void);
+void test_auxds_productions_table_hash(void);
+void test_auxds_lookahead_window(void);
 
 // Forward declarations for Parser tests
 void test_parser_new(void);
@@ -47,6 +70,24 @@ void test_parser_with_callback(void);
 void test_parser_stores_productions(void);
 void test_parser_builds_parse_table(void);
 void test_parser_multiple_instances(void);
+void test_parser_parse_span(void);
+void test_parser_parse_span_ll2(void);
+void test_parser_parse_source(void);
+void test_parser_push_chunks(void);
+void test_parser_stats(void);
+void test_parser_new_from_table(void);
+void test_parser_new_from_tables(void);
+void test_parser_llk_fixpoint(void);
+void test_parser_grammars_side_by_side(void);
+void test_parser_context_reuse(void);
+void test_parser_parse_batch(void);
+void test_parser_arena_rule_action(void);
+void test_parser_rule_action_failure(void);
+void test_parser_parse_batch_arenas(void);
+void test_parser_listener_events(void);
+void test_parser_syntax_tree(void);
+void test_parser_production_actions(void);
+void test_parser_token_records(void);
 
 int main(void)
 {
@@ -65,6 +106,22 @@ int main(void)
     RUN_TEST(test_tknsq_mixed_operations);
     RUN_TEST(test_tknsq_large_operations);
     RUN_TEST(test_tknsq_boundary_values);
+    RUN_TEST(test_tknsq_bulk_operations);
+    RUN_TEST(test_tknsq_bulk_wraparound);
+    printf("\n");
+
+    // ParseArena Tests
+    printf("--- ParseArena Tests ---\n");
+    RUN_TEST(test_prsarn_new);
+    RUN_TEST(test_prsarn_alloc);
+    RUN_TEST(test_prsarn_reset);
+    RUN_TEST(test_prsarn_tree_nodes);
+    printf("\n");
+
+    // ConcreteSyntaxTree Tests
+    printf("--- ConcreteSyntaxTree Tests ---\n");
+    RUN_TEST(test_cst_new);
+    RUN_TEST(test_cst_add_node);
     printf("\n");
 
     // ParserStack Tests
@@ -80,6 +137,8 @@ int main(void)
     RUN_TEST(test_prsrstck_mixed_operations);
     RUN_TEST(test_prsrstck_large_operations);
     RUN_TEST(test_prsrstck_grammar_data);
+    RUN_TEST(test_prsrstck_push_many);
+    RUN_TEST(test_prsrstck_grammar_width);
     printf("\n");
 
     // Auxiliary Data Structure Tests
@@ -91,10 +150,19 @@ int main(void)
     RUN_TEST(test_auxds_build_first_simple);
     RUN_TEST(test_auxds_build_first_allocation);
     RUN_TEST(test_auxds_build_follow_simple);
+    RUN_TEST(test_auxds_build_first_follow_fixpoint);
+    RUN_TEST(test_auxds_build_first_follow_terminal_sets);
     RUN_TEST(test_auxds_build_parse_table);
+    RUN_TEST(test_auxds_parse_table_ll1_lookup);
+    RUN_TEST(test_auxds_parse_table_llk_trie);
+    RUN_TEST(test_auxds_parse_table_ll2_prediction);
+    RUN_TEST(test_auxds_parse_table_save_load);
     RUN_TEST(test_auxds_destroy_first_follow);
     RUN_TEST(test_auxds_grammar_types);
     RUN_TEST(test_auxds_production_multiple_symbols);
+    RUN_TEST(test_auxds_productions_table);
+    RUN_TEST(test_auxds_productions_table_hash);
+    RUN_TEST(test_auxds_lookahead_window);
     printf("\n");
 
     // Parser Tests
@@ -108,6 +176,24 @@ int main(void)
     RUN_TEST(test_parser_stores_productions);
     RUN_TEST(test_parser_builds_parse_table);
     RUN_TEST(test_parser_multiple_instances);
+    RUN_TEST(test_parser_parse_span);
+    RUN_TEST(test_parser_parse_span_ll2);
+    RUN_TEST(test_parser_parse_source);
+    RUN_TEST(test_parser_push_chunks);
+    RUN_TEST(test_parser_stats);
+    RUN_TEST(test_parser_new_from_table);
+    RUN_TEST(test_parser_new_from_tables);
+    RUN_TEST(test_parser_llk_fixpoint);
+    RUN_TEST(test_parser_grammars_side_by_side);
+    RUN_TEST(test_parser_context_reuse);
+    RUN_TEST(test_parser_parse_batch);
+    RUN_TEST(test_parser_arena_rule_action);
+    RUN_TEST(test_parser_rule_action_failure);
+    RUN_TEST(test_parser_parse_batch_arenas);
+    RUN_TEST(test_parser_listener_events);
+    RUN_TEST(test_parser_syntax_tree);
+    RUN_TEST(test_parser_production_actions);
+    RUN_TEST(test_parser_token_records);
     printf("\n");
 
     // Summary
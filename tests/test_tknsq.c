@@ -5,61 +5,59 @@
 // Test: Create a new TokenQueue
 TEST(test_tknsq_new)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
-    ASSERT_EQ(queue->numberOfNodes, 0, "TokenQueue should be empty");
-    ASSERT(queue->head == NULL, "TokenQueue head should be NULL");
-    ASSERT(queue->tail == NULL, "TokenQueue tail should be NULL");
-    free(queue);
+    ASSERT_EQ(queue->numberOfTokens, 0, "TokenQueue should be empty");
+    ASSERT(queue->tokens == NULL, "TokenQueue should not allocate before the first enqueue");
+    TokenQueue__del(queue);
 }
 
 // Test: Enqueue single terminal
 TEST(test_tknsq_enqueue_single)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     CCB_terminal_t terminal = 5;
     int8_t result = TokenQueue__enqueue(queue, terminal);
     ASSERT_EQ(result, CCB_SUCCESS, "Enqueue should return CCB_SUCCESS");
-    ASSERT_EQ(queue->numberOfNodes, 1, "Queue size should be 1");
-    ASSERT_NOT_NULL(queue->head, "Queue head should not be NULL");
-    ASSERT_NOT_NULL(queue->tail, "Queue tail should not be NULL");
+    ASSERT_EQ(queue->numberOfTokens, 1, "Queue size should be 1");
+    ASSERT_NOT_NULL(queue->tokens, "Queue buffer should not be NULL");
 
     // Cleanup
     CCB_terminal_t value;
     TokenQueue__dequeue(queue, &value);
-    free(queue);
+    TokenQueue__del(queue);
 }
 
 // Test: Enqueue multiple terminals
 TEST(test_tknsq_enqueue_multiple)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     for (CCB_terminal_t i = 0; i < 10; i++)
     {
         int8_t result = TokenQueue__enqueue(queue, i);
         ASSERT_EQ(result, CCB_SUCCESS, "Enqueue should succeed");
-        ASSERT_EQ(queue->numberOfNodes, (size_t)(i + 1), "Queue size should increment");
+        ASSERT_EQ(queue->numberOfTokens, (size_t)(i + 1), "Queue size should increment");
     }
 
-    ASSERT_EQ(queue->numberOfNodes, 10, "Queue size should be 10");
+    ASSERT_EQ(queue->numberOfTokens, 10, "Queue size should be 10");
 
     // Cleanup
     CCB_terminal_t value;
-    while (queue->numberOfNodes > 0)
+    while (queue->numberOfTokens > 0)
     {
         TokenQueue__dequeue(queue, &value);
     }
-    free(queue);
+    TokenQueue__del(queue);
 }
 
 // Test: Dequeue single terminal
 TEST(test_tknsq_dequeue_single)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     CCB_terminal_t terminal = 42;
@@ -69,28 +67,28 @@ TEST(test_tknsq_dequeue_single)
     int8_t result = TokenQueue__dequeue(queue, &value);
     ASSERT_EQ(result, CCB_SUCCESS, "Dequeue should return CCB_SUCCESS");
     ASSERT_EQ(value, terminal, "Dequeued value should match enqueued value");
-    ASSERT_EQ(queue->numberOfNodes, 0, "Queue should be empty after dequeue");
+    ASSERT_EQ(queue->numberOfTokens, 0, "Queue should be empty after dequeue");
 
-    free(queue);
+    TokenQueue__del(queue);
 }
 
 // Test: Dequeue from empty queue
 TEST(test_tknsq_dequeue_empty)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     CCB_terminal_t value;
     int8_t result = TokenQueue__dequeue(queue, &value);
     ASSERT_EQ(result, CCB_ERROR, "Dequeue from empty queue should return CCB_ERROR");
 
-    free(queue);
+    TokenQueue__del(queue);
 }
 
 // Test: FIFO order
 TEST(test_tknsq_fifo_order)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     CCB_terminal_t terminals[] = {1, 2, 3, 4, 5};
@@ -111,14 +109,14 @@ TEST(test_tknsq_fifo_order)
         ASSERT_EQ(value, terminals[i], "Value should match FIFO order");
     }
 
-    ASSERT_EQ(queue->numberOfNodes, 0, "Queue should be empty");
-    free(queue);
+    ASSERT_EQ(queue->numberOfTokens, 0, "Queue should be empty");
+    TokenQueue__del(queue);
 }
 
 // Test: Mixed operations
 TEST(test_tknsq_mixed_operations)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     // Enqueue some values
@@ -139,20 +137,20 @@ TEST(test_tknsq_mixed_operations)
     TokenQueue__enqueue(queue, 11);
 
     // Verify remaining values
-    ASSERT_EQ(queue->numberOfNodes, 5, "Queue should have 5 elements");
+    ASSERT_EQ(queue->numberOfTokens, 5, "Queue should have 5 elements");
 
     // Cleanup
-    while (queue->numberOfNodes > 0)
+    while (queue->numberOfTokens > 0)
     {
         TokenQueue__dequeue(queue, &value);
     }
-    free(queue);
+    TokenQueue__del(queue);
 }
 
 // Test: Large number of operations
 TEST(test_tknsq_large_operations)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     size_t large_count = 100;
@@ -164,7 +162,7 @@ TEST(test_tknsq_large_operations)
         ASSERT_EQ(result, CCB_SUCCESS, "Enqueue should succeed");
     }
 
-    ASSERT_EQ(queue->numberOfNodes, large_count, "Queue size should be correct");
+    ASSERT_EQ(queue->numberOfTokens, large_count, "Queue size should be correct");
 
     // Dequeue all values
     for (size_t i = 0; i < large_count; i++)
@@ -175,14 +173,14 @@ TEST(test_tknsq_large_operations)
         ASSERT_EQ(value, (CCB_terminal_t)i, "Value should match");
     }
 
-    ASSERT_EQ(queue->numberOfNodes, 0, "Queue should be empty");
-    free(queue);
+    ASSERT_EQ(queue->numberOfTokens, 0, "Queue should be empty");
+    TokenQueue__del(queue);
 }
 
 // Test: Boundary values
 TEST(test_tknsq_boundary_values)
 {
-    TokenQueue *queue = Queue__new();
+    TokenQueue *queue = TokenQueue__new();
     ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
 
     // Test with CCB_EMPTY_STRING_TR
@@ -202,5 +200,85 @@ TEST(test_tknsq_boundary_values)
     TokenQueue__dequeue(queue, &value);
     ASSERT_EQ(value, max_value, "Should handle maximum uint8_t value");
 
-    free(queue);
+    TokenQueue__del(queue);
+}
+
+// Test: Enqueue and dequeue spans of terminals
+TEST(test_tknsq_bulk_operations)
+{
+    TokenQueue *queue = TokenQueue__new();
+    ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
+
+    CCB_terminal_t terminals[200];
+
+    for (size_t i = 0; i < 200; i++)
+    {
+        terminals[i] = (CCB_terminal_t)(i % CCB_NUM_OF_TERMINALS);
+    }
+
+    int8_t result = TokenQueue__enqueueMany(queue, terminals, 200);
+    ASSERT_EQ(result, CCB_SUCCESS, "Bulk enqueue should succeed");
+    ASSERT_EQ(queue->numberOfTokens, 200, "Queue should have 200 elements");
+
+    CCB_terminal_t buffer[200];
+    size_t numOfDequeued = TokenQueue__dequeueMany(queue, buffer, 150);
+    ASSERT_EQ(numOfDequeued, 150, "Bulk dequeue should return the requested amount");
+
+    for (size_t i = 0; i < 150; i++)
+    {
+        ASSERT_EQ(buffer[i], terminals[i], "Value should match FIFO order");
+    }
+
+    numOfDequeued = TokenQueue__dequeueMany(queue, buffer, 200);
+    ASSERT_EQ(numOfDequeued, 50, "Bulk dequeue should stop when the queue is empty");
+    ASSERT_EQ(buffer[0], terminals[150], "Value should match FIFO order");
+    ASSERT_EQ(queue->numberOfTokens, 0, "Queue should be empty");
+
+    TokenQueue__del(queue);
+}
+
+// Test: Bulk operations across the end of the ring buffer
+TEST(test_tknsq_bulk_wraparound)
+{
+    TokenQueue *queue = TokenQueue__new();
+    ASSERT_NOT_NULL(queue, "TokenQueue should not be NULL");
+
+    CCB_terminal_t terminals[48];
+    CCB_terminal_t buffer[48];
+
+    for (size_t i = 0; i < 48; i++)
+    {
+        terminals[i] = (CCB_terminal_t)(i % CCB_NUM_OF_TERMINALS);
+    }
+
+    /* Moves the head forward so the next spans wrap around */
+    TokenQueue__enqueueMany(queue, terminals, 48);
+    TokenQueue__dequeueMany(queue, buffer, 48);
+
+    size_t capacity = queue->capacity;
+
+    TokenQueue__enqueueMany(queue, terminals, 48);
+    ASSERT_EQ(queue->capacity, capacity, "Queue should reuse its buffer");
+
+    size_t numOfDequeued = TokenQueue__dequeueMany(queue, buffer, 48);
+    ASSERT_EQ(numOfDequeued, 48, "Bulk dequeue should return every element");
+
+    for (size_t i = 0; i < 48; i++)
+    {
+        ASSERT_EQ(buffer[i], terminals[i], "Value should match FIFO order");
+    }
+
+    /* Grows the buffer while the queued tokens wrap around */
+    TokenQueue__enqueueMany(queue, terminals, 48);
+    TokenQueue__enqueueMany(queue, terminals, 48);
+    ASSERT_EQ(queue->numberOfTokens, 96, "Queue should have 96 elements");
+
+    for (size_t i = 0; i < 96; i++)
+    {
+        CCB_terminal_t value;
+        TokenQueue__dequeue(queue, &value);
+        ASSERT_EQ(value, terminals[i % 48], "Value should match FIFO order");
+    }
+
+    TokenQueue__del(queue);
 }
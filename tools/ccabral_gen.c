@@ -0,0 +1,783 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cbarroso/hashmap.h>
+#include <ccabral/_prdcprsntble.h>
+#include <ccabral/_prdstble.h>
+#include <ccabral/constants.h>
+#include <ccabral/prdcdata.h>
+#include <ccabral/types.h>
+
+/* Reads a grammar and writes a C source file with its prediction and productions tables as
+`static const` data, plus a `Parser__newStatic` that creates a parser over them.
+
+The grammar is a text file with one declaration or production per line, and `#` comments:
+
+    %k 1
+    %terminals NUM PLUS LPAREN RPAREN
+    %nonterminals EXPR CLOSE
+    EXPR -> NUM
+    EXPR -> PLUS EXPR EXPR
+    EXPR -> LPAREN EXPR CLOSE
+    CLOSE -> RPAREN
+
+Terminals are numbered from 2 and nonterminals from 0 in declaration order, so the first
+nonterminal is the start one, and productions are numbered in the order they appear. As
+everywhere in ccabral, a right hand side is a terminal followed by nonterminals, or `%empty` */
+
+#define MAX_NAME_LENGTH 64
+#define MAX_LINE_LENGTH 1024
+
+/* Sizes the generator itself is built with, which bound the grammars it accepts */
+#define MAX_NUM_OF_TERMINALS CCB_NUM_OF_TERMINALS
+#define MAX_NUM_OF_NONTERMINALS CCB_NUM_OF_NONTERMINALS
+#define MAX_NUM_OF_PRODUCTIONS CCB_NUM_OF_PRODUCTIONS
+
+typedef char GrammarName[MAX_NAME_LENGTH];
+
+typedef struct GrammarRule
+{
+    CCB_nonterminal_t leftHand;
+    CCB_terminal_t terminal;
+    uint8_t rightHandLength;
+    CCB_nonterminal_t rightHand[UINT8_MAX];
+} GrammarRule;
+
+typedef struct GrammarSpec
+{
+    uint8_t k;
+    GrammarName terminals[MAX_NUM_OF_TERMINALS];
+    size_t numOfTerminals;
+    GrammarName nonterminals[MAX_NUM_OF_NONTERMINALS];
+    size_t numOfNonterminals;
+    GrammarRule rules[MAX_NUM_OF_PRODUCTIONS];
+    size_t numOfRules;
+} GrammarSpec;
+
+static int sFindName(const GrammarName *names, size_t numOfNames, const char *name)
+{
+    for (size_t i = 0; i < numOfNames; i++)
+    {
+        if (strcmp(names[i], name) == 0)
+        {
+            return (int)i;
+        }
+    }
+
+    return -1;
+}
+
+static bool sIsValidName(const char *name)
+{
+    if (!isalpha((unsigned char)name[0]) && name[0] != '_')
+    {
+        return false;
+    }
+
+    for (const char *c = name; *c != '\0'; c++)
+    {
+        if (!isalnum((unsigned char)*c) && *c != '_')
+        {
+            return false;
+        }
+    }
+
+    return strlen(name) < MAX_NAME_LENGTH;
+}
+
+static int8_t sGrammarSpec__declare(GrammarSpec *self,
+                                bool isTerminal,
+                                const char *name,
+                                size_t lineNumber)
+{
+    if (!sIsValidName(name))
+    {
+        fprintf(stderr, "line %zu: %s is not a valid name\n", lineNumber, name);
+        return CCB_ERROR;
+    }
+
+    if (sFindName(self->terminals, self->numOfTerminals, name) >= 0 ||
+        sFindName(self->nonterminals, self->numOfNonterminals, name) >= 0)
+    {
+        fprintf(stderr, "line %zu: %s is declared more than once\n", lineNumber, name);
+        return CCB_ERROR;
+    }
+
+    if (isTerminal)
+    {
+        /* The empty string and end of text take the first two ids */
+        if (self->numOfTerminals + 2 >= MAX_NUM_OF_TERMINALS)
+        {
+            fprintf(stderr, "line %zu: too many terminals\n", lineNumber);
+            return CCB_ERROR;
+        }
+
+        strcpy(self->terminals[self->numOfTerminals++], name);
+    }
+    else
+    {
+        if (self->numOfNonterminals >= MAX_NUM_OF_NONTERMINALS)
+        {
+            fprintf(stderr, "line %zu: too many nonterminals\n", lineNumber);
+            return CCB_ERROR;
+        }
+
+        strcpy(self->nonterminals[self->numOfNonterminals++], name);
+    }
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sGrammarSpec__parseRule(GrammarSpec *self, char *line, size_t lineNumber)
+{
+    if (self->numOfRules >= MAX_NUM_OF_PRODUCTIONS)
+    {
+        fprintf(stderr, "line %zu: too many productions\n", lineNumber);
+        return CCB_ERROR;
+    }
+
+    GrammarRule *rule = &self->rules[self->numOfRules];
+    char *leftHand = strtok(line, " \t");
+    char *arrow = strtok(NULL, " \t");
+    char *first = strtok(NULL, " \t");
+    int leftHandIndex = sFindName(self->nonterminals, self->numOfNonterminals, leftHand);
+
+    if (arrow == NULL || strcmp(arrow, "->") != 0 || first == NULL)
+    {
+        fprintf(stderr, "line %zu: expected `NONTERMINAL -> RIGHT HAND SIDE`\n", lineNumber);
+        return CCB_ERROR;
+    }
+
+    if (leftHandIndex < 0)
+    {
+        fprintf(stderr, "line %zu: %s is not a nonterminal\n", lineNumber, leftHand);
+        return CCB_ERROR;
+    }
+
+    rule->leftHand = (CCB_nonterminal_t)leftHandIndex;
+    rule->rightHandLength = 0;
+
+    if (strcmp(first, "%empty") == 0)
+    {
+        rule->terminal = CCB_EMPTY_STRING_TR;
+
+        if (strtok(NULL, " \t") != NULL)
+        {
+            fprintf(stderr, "line %zu: nothing can follow %%empty\n", lineNumber);
+            return CCB_ERROR;
+        }
+
+        self->numOfRules++;
+        return CCB_SUCCESS;
+    }
+
+    int terminalIndex = sFindName(self->terminals, self->numOfTerminals, first);
+
+    if (terminalIndex < 0)
+    {
+        fprintf(stderr,
+                "line %zu: a right hand side starts with a terminal or %%empty, not %s\n",
+                lineNumber,
+                first);
+        return CCB_ERROR;
+    }
+
+    rule->terminal = (CCB_terminal_t)(terminalIndex + 2);
+
+    for (char *name = strtok(NULL, " \t"); name != NULL; name = strtok(NULL, " \t"))
+    {
+        int nonterminalIndex = sFindName(self->nonterminals, self->numOfNonterminals, name);
+
+        if (nonterminalIndex < 0)
+        {
+            fprintf(stderr,
+                    "line %zu: only nonterminals can follow the first terminal, not %s\n",
+                    lineNumber,
+                    name);
+            return CCB_ERROR;
+        }
+
+        if (rule->rightHandLength == UINT8_MAX - 1)
+        {
+            fprintf(stderr, "line %zu: right hand side is too long\n", lineNumber);
+            return CCB_ERROR;
+        }
+
+        rule->rightHand[rule->rightHandLength++] = (CCB_nonterminal_t)nonterminalIndex;
+    }
+
+    self->numOfRules++;
+    return CCB_SUCCESS;
+}
+
+static int8_t sGrammarSpec__parseLine(GrammarSpec *self, char *line, size_t lineNumber)
+{
+    char *comment = strchr(line, '#');
+
+    if (comment != NULL)
+    {
+        *comment = '\0';
+    }
+
+    line[strcspn(line, "\r\n")] = '\0';
+    line += strspn(line, " \t");
+
+    if (*line == '\0')
+    {
+        return CCB_SUCCESS;
+    }
+
+    if (line[0] != '%')
+    {
+        return sGrammarSpec__parseRule(self, line, lineNumber);
+    }
+
+    char *directive = strtok(line, " \t");
+
+    if (strcmp(directive, "%k") == 0)
+    {
+        char *value = strtok(NULL, " \t");
+        int k = value == NULL ? 0 : atoi(value);
+
+        if (k < 1 || k > UINT8_MAX)
+        {
+            fprintf(stderr, "line %zu: k must be between 1 and %d\n", lineNumber, UINT8_MAX);
+            return CCB_ERROR;
+        }
+
+        self->k = (uint8_t)k;
+        return CCB_SUCCESS;
+    }
+
+    bool isTerminal = strcmp(directive, "%terminals") == 0;
+
+    if (!isTerminal && strcmp(directive, "%nonterminals") != 0)
+    {
+        fprintf(stderr, "line %zu: unknown directive %s\n", lineNumber, directive);
+        return CCB_ERROR;
+    }
+
+    for (char *name = strtok(NULL, " \t"); name != NULL; name = strtok(NULL, " \t"))
+    {
+        if (sGrammarSpec__declare(self, isTerminal, name, lineNumber) <= CCB_ERROR)
+        {
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+static int8_t sGrammarSpec__read(GrammarSpec *self, const char *path)
+{
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to open the grammar %s\n", path);
+        return CCB_ERROR;
+    }
+
+    char line[MAX_LINE_LENGTH];
+    size_t lineNumber = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (sGrammarSpec__parseLine(self, line, ++lineNumber) <= CCB_ERROR)
+        {
+            fclose(file);
+            return CCB_ERROR;
+        }
+    }
+
+    fclose(file);
+
+    if (self->numOfNonterminals == 0)
+    {
+        fprintf(stderr, "The grammar declares no nonterminal\n");
+        return CCB_ERROR;
+    }
+
+    for (size_t nonterminal = 0; nonterminal < self->numOfNonterminals; nonterminal++)
+    {
+        bool hasRule = false;
+
+        for (size_t ruleIndex = 0; ruleIndex < self->numOfRules && !hasRule; ruleIndex++)
+        {
+            hasRule = self->rules[ruleIndex].leftHand == nonterminal;
+        }
+
+        if (!hasRule)
+        {
+            fprintf(stderr, "%s has no production\n", self->nonterminals[nonterminal]);
+            return CCB_ERROR;
+        }
+    }
+
+    return CCB_SUCCESS;
+}
+
+static ProductionsHashMap *sGrammarSpec__buildProductions(const GrammarSpec *self)
+{
+    ProductionsHashMap *productions = HashMap__new(8);
+
+    if (productions == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for productions data\n");
+        return NULL;
+    }
+
+    bool isInitialized[MAX_NUM_OF_NONTERMINALS] = {false};
+
+    for (size_t ruleIndex = 0; ruleIndex < self->numOfRules; ruleIndex++)
+    {
+        const GrammarRule *rule = &self->rules[ruleIndex];
+        ProductionData *production = ProductionData__new(
+            (CCB_production_t)ruleIndex,
+            rule->leftHand,
+            rule->terminal);
+
+        if (production == NULL)
+        {
+            fprintf(stderr, "Failed to create production P%zu\n", ruleIndex);
+            ProductionsHashMap__del(productions);
+            return NULL;
+        }
+
+        for (uint8_t i = 0; i < rule->rightHandLength; i++)
+        {
+            if (ProductionData__insertRightHandGrammar(
+                    production,
+                    rule->rightHand[i]) <= CCB_ERROR)
+            {
+                ProductionData__del(production);
+                ProductionsHashMap__del(productions);
+                return NULL;
+            }
+        }
+
+        int8_t result = isInitialized[rule->leftHand]
+                            ? ProductionsHashMap__insertProdForTerminal(
+                                  productions,
+                                  rule->leftHand,
+                                  production)
+                            : ProductionsHashMap__initializeTerminal(
+                                  productions,
+                                  rule->leftHand,
+                                  production);
+
+        if (result <= CCB_ERROR)
+        {
+            ProductionData__del(production);
+            ProductionsHashMap__del(productions);
+            return NULL;
+        }
+
+        isInitialized[rule->leftHand] = true;
+    }
+
+    return productions;
+}
+
+typedef struct Generator
+{
+    const GrammarSpec *grammar;
+    const PrdcPrsnTble *prdcPrsnTble;
+    const ProductionsTable *productionsTable;
+    const char *prefix;
+    const char *grammarPath;
+} Generator;
+
+static void sGenerator__writeDefinitions(const Generator *self, FILE *out)
+{
+    const GrammarSpec *grammar = self->grammar;
+
+    fprintf(out, "// Nonterminals\n");
+
+    for (size_t i = 0; i < grammar->numOfNonterminals; i++)
+    {
+        fprintf(out, "#define %s_NT (CCB_nonterminal_t)%zu\n", grammar->nonterminals[i], i);
+    }
+
+    fprintf(out, "\n// Terminals\n");
+
+    for (size_t i = 0; i < grammar->numOfTerminals; i++)
+    {
+        fprintf(out, "#define %s_TR (CCB_terminal_t)%zu\n", grammar->terminals[i], i + 2);
+    }
+
+    fprintf(out, "\n// Productions\n");
+
+    for (size_t ruleIndex = 0; ruleIndex < grammar->numOfRules; ruleIndex++)
+    {
+        CCB_nonterminal_t leftHand = grammar->rules[ruleIndex].leftHand;
+        size_t ruleNumber = 1;
+
+        for (size_t previous = 0; previous < ruleIndex; previous++)
+        {
+            ruleNumber += grammar->rules[previous].leftHand == leftHand;
+        }
+
+        fprintf(out,
+                "#define %s_RULE_%zu_PR (CCB_production_t)%zu\n",
+                grammar->nonterminals[leftHand],
+                ruleNumber,
+                ruleIndex);
+    }
+}
+
+static void sGenerator__writeHeader(const Generator *self, FILE *out)
+{
+    fprintf(out, "/* Generated by ccabral-gen from %s. Do not edit */\n\n", self->grammarPath);
+    char guard[MAX_NAME_LENGTH];
+    size_t guardLength = 0;
+
+    for (; self->prefix[guardLength] != '\0'; guardLength++)
+    {
+        guard[guardLength] = (char)toupper((unsigned char)self->prefix[guardLength]);
+    }
+
+    guard[guardLength] = '\0';
+
+    fprintf(out, "#ifndef CCABRAL_GEN_%sPARSER_H\n#define CCABRAL_GEN_%sPARSER_H\n\n", guard, guard);
+    fprintf(out, "#include <ccabral/parser.h>\n#include <ccabral/types.h>\n\n");
+    sGenerator__writeDefinitions(self, out);
+    fprintf(out, "\nParser *%sParser__newStatic(RunRuleActionCallback runRuleAction);\n\n", self->prefix);
+    fprintf(out, "#endif\n");
+}
+
+static void sGenerator__writeLL1Table(const Generator *self, FILE *out)
+{
+    const PrdcPrsnTble *table = self->prdcPrsnTble;
+
+    fprintf(out,
+            "static const CCB_production_t kLL1Table[%zu] = {\n",
+            table->numOfNonterminals * table->numOfTerminals);
+
+    for (size_t nonterminal = 0; nonterminal < table->numOfNonterminals; nonterminal++)
+    {
+        fprintf(out, "   ");
+
+        for (size_t terminal = 0; terminal < table->numOfTerminals; terminal++)
+        {
+            fprintf(out,
+                    " %d,",
+                    PrdcPrsnTble__getLL1Item(
+                        self->prdcPrsnTble,
+                        (CCB_nonterminal_t)nonterminal,
+                        (CCB_terminal_t)terminal));
+        }
+
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "};\n\n");
+}
+
+static void sGenerator__writeTrie(const Generator *self, FILE *out)
+{
+    const PrdcPrsnTble *table = self->prdcPrsnTble;
+
+    fprintf(out, "static const PrdcTrieNode kTrieNodes[%u] = {\n", table->numOfTrieNodes);
+
+    for (uint32_t nodeIndex = 0; nodeIndex < table->numOfTrieNodes; nodeIndex++)
+    {
+        const PrdcTrieNode *node = &table->trieNodes[nodeIndex];
+
+        fprintf(out,
+                "    {%d, %s},\n",
+                node->production,
+                node->isDecisive ? "true" : "false");
+    }
+
+    fprintf(out, "};\n\n");
+
+    /* Most transitions are missing, so only the existing ones are written */
+    fprintf(out,
+            "static const uint32_t kTrieChildren[%zu] = {\n",
+            (size_t)table->numOfTrieNodes * table->numOfTerminals);
+
+    for (uint32_t nodeIndex = 0; nodeIndex < table->numOfTrieNodes; nodeIndex++)
+    {
+        for (size_t terminal = 0; terminal < table->numOfTerminals; terminal++)
+        {
+            uint32_t childIndex = PrdcPrsnTble__getTrieChild(
+                table,
+                nodeIndex,
+                (CCB_terminal_t)terminal);
+
+            if (childIndex != 0)
+            {
+                fprintf(out,
+                        "    [%zu] = %u,\n",
+                        (size_t)nodeIndex * table->numOfTerminals + terminal,
+                        childIndex);
+            }
+        }
+    }
+
+    fprintf(out, "};\n\n");
+    fprintf(out,
+            "static const uint32_t kTrieRoots[%zu] = {",
+            table->numOfNonterminals);
+
+    for (size_t nonterminal = 0; nonterminal < table->numOfNonterminals; nonterminal++)
+    {
+        fprintf(out, "%s%u", nonterminal == 0 ? "" : ", ", table->trieRoots[nonterminal]);
+    }
+
+    fprintf(out, "};\n\n");
+}
+
+static void sGenerator__writeProductionsTable(const Generator *self, FILE *out)
+{
+    const ProductionsTable *table = self->productionsTable;
+    size_t numOfRightHands = 0;
+
+    fprintf(out, "static const CCB_nonterminal_t kLeftHands[%zu] = {", table->numOfProductions + 1);
+
+    for (size_t production = 0; production < table->numOfProductions; production++)
+    {
+        fprintf(out, "%d, ", table->leftHands[production]);
+        numOfRightHands += table->rightHandLengths[production];
+    }
+
+    fprintf(out, "0};\n\n");
+    fprintf(out,
+            "static const uint32_t kRightHandOffsets[%zu] = {",
+            table->numOfProductions + 1);
+
+    for (size_t production = 0; production < table->numOfProductions; production++)
+    {
+        fprintf(out, "%u, ", table->rightHandOffsets[production]);
+    }
+
+    fprintf(out, "0};\n\n");
+    fprintf(out,
+            "static const uint8_t kRightHandLengths[%zu] = {",
+            table->numOfProductions + 1);
+
+    for (size_t production = 0; production < table->numOfProductions; production++)
+    {
+        fprintf(out, "%u, ", table->rightHandLengths[production]);
+    }
+
+    fprintf(out, "0};\n\n");
+    fprintf(out,
+            "/* Right hand sides, each one reversed to be pushed onto the parser stack as it is */\n"
+            "static const GrammarData kRightHands[%zu] = {",
+            numOfRightHands + 1);
+
+    for (size_t i = 0; i < numOfRightHands; i++)
+    {
+        fprintf(out,
+                "{%d, %s}, ",
+                table->rightHands[i].id,
+                table->rightHands[i].type == CCB_TERMINAL_GT
+                    ? "CCB_TERMINAL_GT"
+                    : "CCB_NONTERMINAL_GT");
+    }
+
+    fprintf(out, "{0, 0}};\n\n");
+}
+
+static void sGenerator__writeSource(const Generator *self, FILE *out)
+{
+    const GrammarSpec *grammar = self->grammar;
+    bool isLL1 = grammar->k == 1;
+
+    fprintf(out, "/* Generated by ccabral-gen from %s. Do not edit */\n\n", self->grammarPath);
+    fprintf(out, "#include <stdbool.h>\n#include <stdint.h>\n");
+    fprintf(out, "#include <ccabral/_grmmdata.h>\n");
+    fprintf(out, "#include <ccabral/_prdcprsntble.h>\n");
+    fprintf(out, "#include <ccabral/_prdstble.h>\n");
+    fprintf(out, "#include <ccabral/_sttcprsr.h>\n");
+    fprintf(out, "#include <ccabral/constants.h>\n");
+    fprintf(out, "#include <ccabral/parser.h>\n\n");
+    fprintf(out,
+            "/* The ids of the grammar must fit the ones of the build */\n"
+            "#if CCB_NUM_OF_NONTERMINALS < %zu || CCB_NUM_OF_TERMINALS < %zu || "
+            "CCB_NUM_OF_PRODUCTIONS < %zu\n"
+            "#error \"Compile with at least %zu nonterminals, %zu terminals and %zu productions\"\n"
+            "#endif\n\n",
+            grammar->numOfNonterminals,
+            grammar->numOfTerminals + 2,
+            grammar->numOfRules,
+            grammar->numOfNonterminals,
+            grammar->numOfTerminals + 2,
+            grammar->numOfRules);
+
+    if (isLL1)
+    {
+        sGenerator__writeLL1Table(self, out);
+    }
+    else
+    {
+        sGenerator__writeTrie(self, out);
+    }
+
+    sGenerator__writeProductionsTable(self, out);
+
+    fprintf(out, "static const PrdcPrsnTble kPrdcPrsnTble = {\n");
+    fprintf(out, "    .k = %u,\n", grammar->k);
+    fprintf(out, "    .numOfNonterminals = %zu,\n", self->prdcPrsnTble->numOfNonterminals);
+    fprintf(out, "    .numOfTerminals = %zu,\n", self->prdcPrsnTble->numOfTerminals);
+
+    if (isLL1)
+    {
+        fprintf(out, "    .ll1Table = (CCB_production_t *)kLL1Table,\n");
+    }
+    else
+    {
+        fprintf(out, "    .trieNodes = (PrdcTrieNode *)kTrieNodes,\n");
+        fprintf(out, "    .numOfTrieNodes = %u,\n", self->prdcPrsnTble->numOfTrieNodes);
+        fprintf(out, "    .trieChildren = (uint32_t *)kTrieChildren,\n");
+        fprintf(out, "    .trieRoots = (uint32_t *)kTrieRoots,\n");
+    }
+
+    fprintf(out, "};\n\n");
+    fprintf(out, "static const ProductionsTable kProductionsTable = {\n");
+    fprintf(out, "    .numOfProductions = %zu,\n", self->productionsTable->numOfProductions);
+    fprintf(out, "    .leftHands = (CCB_nonterminal_t *)kLeftHands,\n");
+    fprintf(out, "    .rightHandOffsets = (uint32_t *)kRightHandOffsets,\n");
+    fprintf(out, "    .rightHandLengths = (uint8_t *)kRightHandLengths,\n");
+    fprintf(out, "    .rightHands = (GrammarData *)kRightHands,\n");
+    fprintf(out, "};\n\n");
+    fprintf(out, "Parser *%sParser__newStatic(RunRuleActionCallback runRuleAction)\n{\n", self->prefix);
+    fprintf(out, "    return Parser__newFromTables(&kPrdcPrsnTble, &kProductionsTable, runRuleAction);\n");
+    fprintf(out, "}\n");
+}
+
+static int8_t sGenerator__writeFile(const Generator *self,
+                                    const char *path,
+                                    void (*write)(const Generator *, FILE *))
+{
+    FILE *out = fopen(path, "w");
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "Failed to create %s\n", path);
+        return CCB_ERROR;
+    }
+
+    write(self, out);
+
+    if (fclose(out) != 0)
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+        return CCB_ERROR;
+    }
+
+    return CCB_SUCCESS;
+}
+
+static void sPrintUsage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [--prefix NAME] [--header OUTPUT.h] GRAMMAR OUTPUT.c\n",
+            program);
+}
+
+int main(int argc, char **argv)
+{
+    const char *prefix = "";
+    const char *headerPath = NULL;
+    const char *paths[2];
+    size_t numOfPaths = 0;
+
+    for (int argIndex = 1; argIndex < argc; argIndex++)
+    {
+        if (strcmp(argv[argIndex], "--prefix") == 0 && argIndex + 1 < argc)
+        {
+            prefix = argv[++argIndex];
+        }
+        else if (strcmp(argv[argIndex], "--header") == 0 && argIndex + 1 < argc)
+        {
+            headerPath = argv[++argIndex];
+        }
+        else if (numOfPaths < 2 && argv[argIndex][0] != '-')
+        {
+            paths[numOfPaths++] = argv[argIndex];
+        }
+        else
+        {
+            sPrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (numOfPaths != 2 || (prefix[0] != '\0' && !sIsValidName(prefix)))
+    {
+        sPrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    GrammarSpec *grammar = calloc(1, sizeof(GrammarSpec));
+
+    if (grammar == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the grammar\n");
+        return EXIT_FAILURE;
+    }
+
+    grammar->k = 1;
+
+    if (sGrammarSpec__read(grammar, paths[0]) <= CCB_ERROR)
+    {
+        fprintf(stderr, "Failed to read the grammar %s\n", paths[0]);
+        free(grammar);
+        return EXIT_FAILURE;
+    }
+
+    ProductionsHashMap *productions = sGrammarSpec__buildProductions(grammar);
+    PrdcPrsnTble *prdcPrsnTble = productions == NULL
+                                     ? NULL
+                                     : PrdcPrsnTble__new(productions, grammar->k);
+    ProductionsTable *productionsTable = prdcPrsnTble == NULL
+                                             ? NULL
+                                             : ProductionsTable__new(productions);
+    int status = EXIT_FAILURE;
+
+    if (productionsTable == NULL)
+    {
+        fprintf(stderr, "Failed to build the tables of %s\n", paths[0]);
+    }
+    else
+    {
+        Generator generator = {
+            grammar,
+            prdcPrsnTble,
+            productionsTable,
+            prefix,
+            paths[0],
+        };
+
+        if (sGenerator__writeFile(&generator, paths[1], sGenerator__writeSource) == CCB_SUCCESS &&
+            (headerPath == NULL ||
+             sGenerator__writeFile(&generator, headerPath, sGenerator__writeHeader) == CCB_SUCCESS))
+        {
+            status = EXIT_SUCCESS;
+        }
+    }
+
+    if (productionsTable != NULL)
+    {
+        ProductionsTable__del(productionsTable);
+    }
+
+    if (prdcPrsnTble != NULL)
+    {
+        PrdcPrsnTble__del(prdcPrsnTble);
+    }
+
+    if (productions != NULL)
+    {
+        ProductionsHashMap__del(productions);
+    }
+
+    free(grammar);
+
+    return status;
+}